@@ -0,0 +1,21 @@
+#!/bin/sh
+# Compares the adders (option -a) on the programs in Simple and CSP:
+# the number of clauses, the formula generation time (including the
+# conversion to CNF) and the solving time.
+#
+# usage: ./benchmark_adders.sh [ursa binary] [other ursa options, e.g. -l64]
+# run from the examples directory; TIMEOUT=<seconds> limits each run
+
+URSA=${1:-../src/ursa}
+[ $# -gt 0 ] && shift
+
+printf "%-36s %-11s %10s %12s %12s\n" program adders clauses generation solving
+for f in Simple/*.urs CSP/*.urs; do
+  for a in ripple koggestone brentkung; do
+    ${TIMEOUT:+timeout $TIMEOUT} "$URSA" -q -a$a "$@" < "$f" 2>&1 | awk -v f="$f" -v a="$a" '
+      /Formula size:/      { clauses += $5 }
+      /Formula generation/ { sub(/s\]$/, "", $9); generation += $9 }
+      /Solving time/       { sub(/s\]$/, "", $3); solving += $3 }
+      END { printf "%-36s %-11s %10d %11.4fs %11.4fs\n", f, a, clauses, generation, solving }'
+  done
+done
@@ -0,0 +1,21 @@
+#!/bin/sh
+# Reports, for the programs in Simple and CSP, the statistics printed by
+# the interpreter with -v at the last solving (counted since the formulas
+# were last cleared, i.e. for the last value tested by an optimization):
+# the formula nodes created, the reference count updates of formulas and
+# the updates per node, the formula vectors allocated on the heap and the
+# reallocations of the node arrays.
+#
+# usage: ./benchmark_refcounts.sh [ursa binary] [other ursa options, e.g. -l64]
+# run from the examples directory; TIMEOUT=<seconds> limits each run
+
+URSA=${1:-../src/ursa}
+[ $# -gt 0 ] && shift
+
+printf "%-36s %10s %12s %10s %12s %12s\n" program nodes updates per-node heap-vectors node-growths
+for f in Simple/*.urs CSP/*.urs; do
+  ${TIMEOUT:+timeout $TIMEOUT} "$URSA" -q -v "$@" < "$f" 2>&1 | awk -v f="$f" '
+    /Reference counts:/ { nodes = $3; updates = $6 }
+    /Allocations:/      { vectors = $2; growths = $8 }
+    END { printf "%-36s %10d %12d %10.2f %12d %12d\n", f, nodes, updates, nodes ? updates/nodes : 0, vectors, growths }'
+done
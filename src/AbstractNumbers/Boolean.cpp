@@ -13,8 +13,11 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 GNU General Public License for more details.
 **************************************************************************************/
 
+#include <assert.h>
 #include <Boolean.hpp>
 #include <Number.hpp>
+#include <Cardinality.h>
+#include <utility>
 
 #define DEF_B_OP(OPERATOR) \
    Boolean Boolean::operator OPERATOR (const Boolean &b) { \
@@ -61,17 +64,22 @@ GNU General Public License for more details.
     SetType(eGroundBoolean); 
   }  
 
-  Boolean::Boolean(const Boolean& b) { 
+  Boolean::Boolean(const Boolean& b) : m_bW(b.m_bW) { 
     // cout << "3a" << endl; 
     m_bB     =b.m_bB; 
-    m_bW     =b.m_bW; 
+    m_nID    =b.m_nID;
+    m_VarType=b.m_VarType;
+  }    
+
+  Boolean::Boolean(Boolean&& b) : m_bW(std::move(b.m_bW)) { 
+    m_bB     =b.m_bB; 
     m_nID    =b.m_nID;
     m_VarType=b.m_VarType;
   }    
 
   Boolean::~Boolean() {}
 
-  Boolean& Boolean::operator = (Boolean b) { 
+  Boolean& Boolean::operator = (const Boolean& b) { 
     //cout << "4a" << endl; 
     m_bB     =b.m_bB; 
     m_bW     =b.m_bW; 
@@ -80,6 +88,14 @@ GNU General Public License for more details.
     return *this;
   }
 
+  Boolean& Boolean::operator = (Boolean&& b) { 
+    m_bB     =b.m_bB; 
+    m_bW     =std::move(b.m_bW); 
+    m_nID    =b.m_nID;
+    m_VarType=b.m_VarType;
+    return *this;
+  }
+
   void Boolean::SetConstraint(bool b) {
     m_bW.SetConstraint(b);
   }
@@ -126,6 +142,128 @@ GNU General Public License for more details.
   }
 
 
+  Boolean Boolean::AtMost(const vector<Boolean> &b, const Number &k) {
+     return Counting(b, k, true, false);
+  }
+
+  Boolean Boolean::AtLeast(const vector<Boolean> &b, const Number &k) {
+     return Counting(b, k, false, true);
+  }
+
+  Boolean Boolean::Exactly(const vector<Boolean> &b, const Number &k) {
+     return Counting(b, k, true, true);
+  }
+
+  // k >= v, false if v cannot be represented
+  static Boolean NotLess(const Number &k, unsigned long v) {
+     if(iAbstractNumberLength < 8*sizeof(unsigned long) && (v >> iAbstractNumberLength))
+       return Boolean(false);
+     Number n(k);
+     return n >= Number(v);
+  }
+
+  Boolean Boolean::Counting(const vector<Boolean> &b, const Number &k, bool bAtMost, bool bAtLeast) {
+     unsigned int t = 0, n = 0, i;
+     for(i = 0; i < b.size(); i++)
+       if(b[i].IsGroundBoolean())
+         t += b[i].m_bB;
+       else
+         n++;
+
+     FormulaVector x(n);
+     for(i = 0, n = 0; i < b.size(); i++)
+       if(!b[i].IsGroundBoolean())
+         x.setFormulaAt(n++, b[i].m_bW[0]);
+
+     Boolean m(false);
+     if(k.IsGroundNumber())  {
+       unsigned long kk = k.GetGroundValueUnsigned();
+       if(kk < t) 
+         m.m_bB = !bAtMost;
+       else if(n == 0)
+         m.m_bB = !bAtLeast || kk == t;
+       else {
+         kk -= t;
+         if(bAtMost && bAtLeast)
+           m.m_bW = Cardinality::Exactly(x, kk);
+         else if(bAtMost)
+           m.m_bW = Cardinality::AtMost(x, kk);
+         else
+           m.m_bW = Cardinality::AtLeast(x, kk);
+         m.SetType(eAbstractBoolean);
+       }
+       return m;
+     }
+
+     // the count is t plus the binary count, if t+n fits in the numbers
+     unsigned int w = 0;
+     while(w < 8*sizeof(unsigned long) && ((unsigned long)t+n) >> w)
+       w++;
+     if(w <= iAbstractNumberLength && Cardinality::PreferSum(n, n))  {
+       Number s((unsigned int)0);
+       s.m_nW = Cardinality::Sum(x, iAbstractNumberLength);
+       s.SetType(eAbstractNumber);
+       s = s + Number(t);
+       if(bAtMost && bAtLeast)
+         return s == k;
+       else if(bAtMost)
+         return s <= k;
+       else
+         return s >= k;
+     }
+
+     // otherwise it is t plus the unary count c: it is at most k iff k >= t
+     // and c[j-1] implies k >= t+j, at least k iff k >= t+j implies c[j-1]
+     // and k < t+n+1
+     FormulaVector c = Cardinality::Count(x, n);
+     m.m_bB = true;
+     if(bAtMost)
+       m = m & NotLess(k, t);
+     if(bAtLeast)
+       m = m & NotLess(k, (unsigned long)t+n+1).negate();
+     for(i = 1; i <= n; i++)  {
+       Boolean cj(false);
+       cj.m_bW = c[i-1];
+       cj.SetType(eAbstractBoolean);
+       Boolean ge = NotLess(k, (unsigned long)t+i);
+       if(bAtMost)
+         m = m & (cj.negate() | ge);
+       if(bAtLeast)
+         m = m & (ge.negate() | cj);
+     }
+     return m;
+  }
+
+  Boolean Boolean::WeightedAtMost(const vector<Boolean> &b, const vector<Number> &w, const Number &k) {
+     assert(k.IsGroundNumber());
+     unsigned long t = 0, kk = k.GetGroundValueUnsigned();
+     vector<unsigned long> weights;
+     unsigned int i, n = 0;
+
+     for(i = 0; i < b.size(); i++)  {
+       assert(w[i].IsGroundNumber());
+       if(b[i].IsGroundBoolean())
+         t += (b[i].m_bB ? w[i].GetGroundValueUnsigned() : 0);
+       else  {
+         weights.push_back(w[i].GetGroundValueUnsigned());
+         n++;
+       }
+     }
+
+     FormulaVector x(n);
+     for(i = 0, n = 0; i < b.size(); i++)
+       if(!b[i].IsGroundBoolean())
+         x.setFormulaAt(n++, b[i].m_bW[0]);
+
+     Boolean m(t <= kk);
+     if(t <= kk && n > 0)  {
+       m.m_bW = Cardinality::WeightedAtMost(x, weights, kk - t);
+       m.SetType(eAbstractBoolean);
+     }
+     return m;
+  }
+
+
   Number Boolean::Int() const {
      Number m((unsigned int)0);                           
      if(IsGroundBoolean())  {
@@ -32,8 +32,10 @@ public:
   Boolean(unsigned int* iVarCounter);   
   Boolean(bool b);  
   Boolean(const Boolean& b);    
+  Boolean(Boolean&& b);    
   ~Boolean();
-  Boolean& operator = (Boolean b);
+  Boolean& operator = (const Boolean& b);
+  Boolean& operator = (Boolean&& b);
 
   void SetConstraint(bool b);
   Boolean negate() const;
@@ -43,6 +45,15 @@ public:
   Boolean operator ^ (const Boolean &b);
 
   Boolean ite(const Boolean &b, const Boolean &b2) const;
+
+  // cardinality constraints: the number of true booleans compared to k
+  static Boolean AtMost(const vector<Boolean> &b, const Number &k);
+  static Boolean AtLeast(const vector<Boolean> &b, const Number &k);
+  static Boolean Exactly(const vector<Boolean> &b, const Number &k);
+  // the sum of the weights of the true booleans is at most k (the weights
+  // and k have to be ground)
+  static Boolean WeightedAtMost(const vector<Boolean> &b, const vector<Number> &w, const Number &k);
+
   Number Int() const;
   void print() const;
   void PrintValue() const;
@@ -57,11 +68,14 @@ public:
   void SetIsDependent() { m_nID=-1; }
 
   bool GetGroundValue() const { return m_bB; }
-  AbstractBoolean GetAbstractValue() const { return m_bW; }
+  const AbstractBoolean& GetAbstractValue() const { return m_bW; }
 
   void SetAccessed(bool b) { bAccessed=b; }
   bool GetAccessed() const { return bAccessed; }
 
+  // the common part of AtMost, AtLeast and Exactly
+  static Boolean Counting(const vector<Boolean> &b, const Number &k, bool bAtMost, bool bAtLeast);
+
 /*private: */
   bool m_bB;
   AbstractBoolean m_bW;
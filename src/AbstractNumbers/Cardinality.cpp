@@ -0,0 +1,619 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA.
+Authors: Milan Sesum and Predrag Janicic
+
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#include <assert.h>
+#include <limits.h>
+#include <map>
+#include <set>
+#include <algorithm>
+#include "Cardinality.h"
+#include "FormulaFactory.h"
+
+
+////////////////////////////////////////////////////////////////////////////////
+////	Class Cardinality
+////////////////////////////////////////////////////////////////////////////////
+
+
+// the number of bits of v
+static unsigned int Bits(unsigned long v) {
+  unsigned int w = 0;
+  for (; v; v >>= 1)
+    w++;
+  return w;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector Cardinality::Count(const FormulaVector &x, unsigned int m) {
+  unsigned int n = x.getSize();
+  assert(m <= n);
+
+  if (m == 0)
+    return FormulaVector(0);
+
+  unsigned long network = SortingNetworkSize(n, m, ULONG_MAX);
+  unsigned long sequential = SequentialCounterSize(n, m, network);
+  unsigned long totalizer = TotalizerSize(n, m, min(network, sequential));
+
+  if (sequential <= totalizer && sequential <= network)
+    return SequentialCounter(x, m);
+  else if (totalizer <= network)
+    return Totalizer(x, 0, n, m);
+  else
+    return SortingNetwork(x, m);
+}
+
+
+// -------------------------------------------------------------------
+
+
+// on a tie the unary counter is chosen, as it propagates better
+bool Cardinality::PreferSum(unsigned int n, unsigned int m) {
+  unsigned long adders = AddersSize(n, m);
+  return SortingNetworkSize(n, m, adders) > adders &&
+         SequentialCounterSize(n, m, adders) > adders &&
+         TotalizerSize(n, m, adders) > adders;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector Cardinality::Sum(const FormulaVector &x, unsigned int width) {
+  FormulaVector s(width);
+  if (x.getSize() == 0)
+    return s;
+
+  FormulaVector c = Adders(x, 0, x.getSize());
+  assert(c.getSize() <= width);
+  for (unsigned int i = 0; i < c.getSize(); i++)
+    s.setFormulaAt(width - 1 - i, c[i]);
+  return s;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 Cardinality::AtMost(const FormulaVector &x, unsigned int k) {
+  FormulaVector1 result;
+
+  if (k >= x.getSize())
+    result = FormulaFactory::Instance()->GetConst(true);
+  else if (PreferSum(x.getSize(), k + 1)) {
+    FormulaVector c = Adders(x, 0, x.getSize());
+    result = Formula::makeNot(AtLeastBinary(c, k + 1)[0]);
+  }
+  else {
+    FormulaVector c = Count(x, k + 1);
+    result = Formula::makeNot(c[k]);
+  }
+
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 Cardinality::AtLeast(const FormulaVector &x, unsigned int k) {
+  FormulaVector1 result;
+
+  if (k == 0)
+    result = FormulaFactory::Instance()->GetConst(true);
+  else if (k > x.getSize())
+    result = FormulaFactory::Instance()->GetConst(false);
+  else if (PreferSum(x.getSize(), k)) {
+    FormulaVector c = Adders(x, 0, x.getSize());
+    result = AtLeastBinary(c, k);
+  }
+  else {
+    FormulaVector c = Count(x, k);
+    result = c[k - 1];
+  }
+
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 Cardinality::Exactly(const FormulaVector &x, unsigned int k) {
+  unsigned int n = x.getSize();
+  FormulaVector1 result;
+
+  if (k > n)
+    result = FormulaFactory::Instance()->GetConst(false);
+  else if (PreferSum(n, k < n ? k + 1 : n)) {
+    // the bits of the count are those of k
+    FormulaVector c = Adders(x, 0, n);
+    result = FormulaFactory::Instance()->GetConst(true);
+    for (unsigned int i = 0; i < c.getSize(); i++)
+      result = Formula::makeAnd(result[0], ((k >> i) & 1 ? c[i] : Formula::makeNot(c[i])));
+  }
+  else {
+    FormulaVector c = Count(x, k < n ? k + 1 : n);
+    Formula f = (k == 0 ? FormulaFactory::Instance()->GetConst(true) : c[k - 1]);
+    if (k < n)
+      f = Formula::makeAnd(f, Formula::makeNot(c[k]));
+    result = f;
+  }
+
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the diagram is built level by level, bottom up: the node for the level i
+// and the bound r stands for "the sum of the weights of the true formulas
+// among i, i+1, ... is at most r"; larger weights are decided first
+FormulaVector1 Cardinality::WeightedAtMost(const FormulaVector &x, const vector<unsigned long> &w, unsigned long k) {
+  assert(x.getSize() == w.size());
+
+  vector<pair<unsigned long, unsigned int> > order;
+  for (unsigned int i = 0; i < w.size(); i++)
+    if (w[i])
+      order.push_back(make_pair(w[i], i));
+  stable_sort(order.rbegin(), order.rend());
+
+  unsigned int n = order.size();
+  vector<unsigned long> rest(n + 1, 0);
+  for (int i = n - 1; i >= 0; i--)
+    rest[i] = rest[i + 1] + order[i].first;
+
+  Formula T = FormulaFactory::Instance()->GetConst(true);
+  Formula NT = FormulaFactory::Instance()->GetConst(false);
+  FormulaVector1 result;
+
+  if (k >= rest[0]) {
+    result = T;
+    return result;
+  }
+
+  // the bounds reachable at each level, only those of undecided nodes
+  vector<set<unsigned long> > bounds(n);
+  bounds[0].insert(k);
+  for (unsigned int i = 0; i + 1 < n; i++)
+    for (set<unsigned long>::iterator r = bounds[i].begin(); r != bounds[i].end(); r++) {
+      if (*r >= order[i].first && *r - order[i].first < rest[i + 1])
+        bounds[i + 1].insert(*r - order[i].first);
+      if (*r < rest[i + 1])
+        bounds[i + 1].insert(*r);
+    }
+
+  map<unsigned long, Formula> level, next;
+  map<unsigned long, Formula>::iterator it;
+  for (int i = n - 1; i >= 0; i--) {
+    Formula v = x[order[i].second];
+    unsigned long wi = order[i].first;
+
+    for (set<unsigned long>::iterator r = bounds[i].begin(); r != bounds[i].end(); r++) {
+      Formula hi, lo;
+      if (*r < wi)
+        hi = NT;
+      else
+        hi = (*r - wi >= rest[i + 1] ? T : next[*r - wi]);
+      lo = (*r >= rest[i + 1] ? T : next[*r]);
+
+      // hi implies lo, so ite(v, hi, lo) is lo & (~v | hi)
+      Formula f = Formula::makeAnd(lo, Formula::makeOr(Formula::makeNot(v), hi));
+      f.IncRefCount();
+      f.SetShared();
+      level[*r] = f;
+    }
+
+    for (it = next.begin(); it != next.end(); it++) {
+      it->second.DecRefCount();
+      FormulaFactory::Instance()->Remove(it->second);
+    }
+    next.swap(level);
+    level.clear();
+  }
+
+  result = next[k];
+  for (it = next.begin(); it != next.end(); it++) {
+    it->second.DecRefCount();
+    FormulaFactory::Instance()->Remove(it->second);
+  }
+
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// s[j] is true iff at least j+1 of the formulas seen so far are true
+FormulaVector Cardinality::SequentialCounter(const FormulaVector &x, unsigned int m) {
+  FormulaVector s(m);
+
+  for (unsigned int i = 0; i < x.getSize(); i++)
+    for (int j = min(i, m - 1); j >= 0; j--) {
+      Formula f = (j == 0 ? x[i] : Formula::makeAnd(x[i], s[j - 1]));
+      s.setFormulaAt(j, Formula::makeOr(s[j], f));
+      s[j].SetShared();
+    }
+
+  return s;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the counts of the two halves are merged: at least t+1 formulas are true
+// iff at least i of the first half and t+1-i of the second half are true
+FormulaVector Cardinality::Totalizer(const FormulaVector &x, unsigned int from, unsigned int to, unsigned int m) {
+  if (to - from == 1) {
+    FormulaVector r(1);
+    r.setFormulaAt(0, x[from]);
+    return r;
+  }
+
+  unsigned int middle = from + (to - from) / 2;
+  FormulaVector a = Totalizer(x, from, middle, m);
+  FormulaVector b = Totalizer(x, middle, to, m);
+  unsigned int p = a.getSize(), q = b.getSize();
+  FormulaVector r(min(p + q, m));
+
+  for (unsigned int t = 0; t < r.getSize(); t++) {
+    Formula f = FormulaFactory::Instance()->GetConst(false);
+    for (unsigned int i = (t + 1 > q ? t + 1 - q : 0); i <= p && i <= t + 1; i++) {
+      unsigned int j = t + 1 - i;
+      if (i == 0)
+        f = Formula::makeOr(f, b[j - 1]);
+      else if (j == 0)
+        f = Formula::makeOr(f, a[i - 1]);
+      else
+        f = Formula::makeOr(f, Formula::makeAnd(a[i - 1], b[j - 1]));
+    }
+    r.setFormulaAt(t, f);
+    f.SetShared();
+  }
+
+  return r;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the counts of the two halves are added by a ripple-carry adder; the
+// carry out of the last bit is false, as the count fits in its bits
+FormulaVector Cardinality::Adders(const FormulaVector &x, unsigned int from, unsigned int to) {
+  if (to - from == 1) {
+    FormulaVector r(1);
+    r.setFormulaAt(0, x[from]);
+    return r;
+  }
+
+  unsigned int middle = from + (to - from) / 2;
+  FormulaVector a = Adders(x, from, middle);
+  FormulaVector b = Adders(x, middle, to);
+  FormulaVector r(Bits(to - from));
+
+  Formula F = FormulaFactory::Instance()->GetConst(false);
+  Formula carry = F;
+  carry.IncRefCount();
+  for (unsigned int i = 0; i < r.getSize(); i++) {
+    Formula u = (i < a.getSize() ? a[i] : F), v = (i < b.getSize() ? b[i] : F);
+    Formula uv = Formula::makeXor(u, v);
+    uv.IncRefCount();
+    r.setFormulaAt(i, Formula::makeXor(uv, carry));
+
+    Formula next = F;
+    if (i + 1 < r.getSize())
+      next = Formula::makeOr(Formula::makeAnd(u, v), Formula::makeAnd(carry, uv));
+    next.IncRefCount();
+    carry.DecRefCount();
+    FormulaFactory::Instance()->Remove(carry);
+    uv.DecRefCount();
+    FormulaFactory::Instance()->Remove(uv);
+    carry = next;
+  }
+  carry.DecRefCount();
+  FormulaFactory::Instance()->Remove(carry);
+
+  return r;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// from the least significant bit up: c >= t up to the bit i iff c_i > t_i,
+// or c_i == t_i and c >= t below i
+FormulaVector1 Cardinality::AtLeastBinary(const FormulaVector &c, unsigned long t) {
+  FormulaVector1 g;
+  g = FormulaFactory::Instance()->GetConst(true);
+  for (unsigned int i = 0; i < c.getSize(); i++)
+    g = ((t >> i) & 1 ? Formula::makeAnd(c[i], g[0]) : Formula::makeOr(c[i], g[0]));
+  return g;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// Batcher's odd-even merge sort for the smallest power of two not smaller
+// than n; the missing inputs are false and stay at the end, so comparators
+// involving them are left out
+template <class F> void Cardinality::ForEachComparator(unsigned int n, F &f) {
+  unsigned int size = 1;
+  while (size < n)
+    size <<= 1;
+
+  for (unsigned int p = 1; p < size; p <<= 1)
+    for (unsigned int k = p; k >= 1; k >>= 1)
+      for (unsigned int j = k % p; j + k < n; j += 2 * k)
+        for (unsigned int i = 0; i < k && i + j + k < n; i++)
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+            f(i + j, i + j + k);
+}
+
+
+// the larger value goes to the smaller position
+struct Comparator {
+  FormulaVector &s;
+  Comparator(FormulaVector &v) : s(v) {}
+  void operator () (unsigned int i, unsigned int j) {
+    Formula hi = Formula::makeOr(s[i], s[j]);
+    Formula lo = Formula::makeAnd(s[i], s[j]);
+    // lo may be one of the operands, it must survive the first update
+    lo.IncRefCount();
+    s.setFormulaAt(i, hi);
+    s.setFormulaAt(j, lo);
+    lo.DecRefCount();
+    hi.SetShared();
+    lo.SetShared();
+  }
+};
+
+
+FormulaVector Cardinality::SortingNetwork(const FormulaVector &x, unsigned int m) {
+  FormulaVector s(x);
+  Comparator comparator(s);
+  ForEachComparator(x.getSize(), comparator);
+
+  FormulaVector c(m);
+  for (unsigned int j = 0; j < m; j++)
+    c.setFormulaAt(j, s[j]);
+  return c;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// The sizes are the numbers of clauses of the CNF of the encodings. They
+// are estimated on the shape of the circuit: as in the CNF conversion, the
+// operands of nested gates of the same kind are collected into one gate,
+// which is defined by one clause per operand and one more, unless the
+// nested gate is shared. Such a gate is defined when it is an output, an
+// operand of a gate of the other kind or shared. A XOR is defined by four
+// clauses, and its operands are always defined. A shape with more gates
+// than the limit is not built further.
+class CircuitShape {
+
+public:
+
+  enum { False = 0 };
+
+  CircuitShape(unsigned long l) : limit(l) { Add(CONST, 0, 0, 0); }
+
+  unsigned int Input() { return Add(VAR, 0, 0, 1); }
+  unsigned int And(unsigned int a, unsigned int b) { return Gate(AND, a, b); }
+  unsigned int Or(unsigned int a, unsigned int b) { return Gate(OR, a, b); }
+  unsigned int Xor(unsigned int a, unsigned int b) {
+    if (a == False || b == False)
+      return (a == False ? b : a);
+    return Add(XOR, a, b, 2);
+  }
+  void Share(unsigned int a) { nodes[a].shared = true; }
+
+  bool Overflow() const { return nodes.size() > limit; }
+
+  unsigned long Clauses(unsigned int output) {
+    if (Overflow())
+      return ULONG_MAX;
+
+    vector<bool> reached(nodes.size(), false), defined(nodes.size(), false);
+    vector<unsigned int> stack(1, output);
+    reached[output] = defined[output] = true;
+    while (!stack.empty()) {
+      const Node &g = nodes[stack.back()];
+      stack.pop_back();
+      if (g.type != AND && g.type != OR && g.type != XOR)
+        continue;
+      unsigned int operands[2] = { g.left, g.right };
+      for (unsigned int i = 0; i < 2; i++) {
+        unsigned int o = operands[i];
+        if (nodes[o].type != g.type || nodes[o].shared || g.type == XOR)
+          defined[o] = true;
+        if (!reached[o]) {
+          reached[o] = true;
+          stack.push_back(o);
+        }
+      }
+    }
+
+    unsigned long clauses = 0;
+    for (unsigned int i = 0; i < nodes.size(); i++)
+      if (defined[i] && (nodes[i].type == AND || nodes[i].type == OR))
+        clauses += nodes[i].operands + 1;
+      else if (defined[i] && nodes[i].type == XOR)
+        clauses += 4;
+    return clauses;
+  }
+
+private:
+
+  struct Node {
+    FORMULA_TYPE type;
+    unsigned int left, right;
+    unsigned long operands;
+    bool shared;
+  };
+
+  unsigned int Add(FORMULA_TYPE type, unsigned int left, unsigned int right, unsigned long operands) {
+    if (Overflow())
+      return False;
+    Node g = { type, left, right, operands, false };
+    nodes.push_back(g);
+    return nodes.size() - 1;
+  }
+
+  unsigned int Gate(FORMULA_TYPE type, unsigned int a, unsigned int b) {
+    if (a == False || b == False)
+      return (type == AND ? (unsigned int)False : (a == False ? b : a));
+    return Add(type, a, b, Operands(type, a) + Operands(type, b));
+  }
+
+  unsigned long Operands(FORMULA_TYPE type, unsigned int a) const {
+    return (nodes[a].type == type && !nodes[a].shared ? nodes[a].operands : 1);
+  }
+
+  unsigned long limit;
+  vector<Node> nodes;
+};
+
+
+// -------------------------------------------------------------------
+
+
+unsigned long Cardinality::SequentialCounterSize(unsigned int n, unsigned int m, unsigned long limit) {
+  CircuitShape c(limit);
+  vector<unsigned int> s(m, CircuitShape::False);
+
+  for (unsigned int i = 0; i < n && !c.Overflow(); i++) {
+    unsigned int x = c.Input();
+    for (int j = min(i, m - 1); j >= 0; j--) {
+      s[j] = c.Or(s[j], (j == 0 ? x : c.And(x, s[j - 1])));
+      c.Share(s[j]);
+    }
+  }
+
+  return c.Clauses(s[m - 1]);
+}
+
+
+// -------------------------------------------------------------------
+
+
+static vector<unsigned int> TotalizerShape(CircuitShape &c, unsigned int n, unsigned int m) {
+  if (n == 1)
+    return vector<unsigned int>(1, c.Input());
+
+  vector<unsigned int> a = TotalizerShape(c, n / 2, m);
+  vector<unsigned int> b = TotalizerShape(c, n - n / 2, m);
+  unsigned int p = a.size(), q = b.size();
+  vector<unsigned int> r(min(p + q, m));
+
+  for (unsigned int t = 0; t < r.size() && !c.Overflow(); t++) {
+    unsigned int f = CircuitShape::False;
+    for (unsigned int i = (t + 1 > q ? t + 1 - q : 0); i <= p && i <= t + 1; i++) {
+      unsigned int j = t + 1 - i;
+      f = c.Or(f, (i == 0 ? b[j - 1] : (j == 0 ? a[i - 1] : c.And(a[i - 1], b[j - 1]))));
+    }
+    r[t] = f;
+    c.Share(f);
+  }
+
+  return r;
+}
+
+
+unsigned long Cardinality::TotalizerSize(unsigned int n, unsigned int m, unsigned long limit) {
+  CircuitShape c(limit);
+  vector<unsigned int> r = TotalizerShape(c, n, m);
+  return c.Clauses(r[m - 1]);
+}
+
+
+// -------------------------------------------------------------------
+
+
+struct ComparatorShape {
+  CircuitShape &c;
+  vector<unsigned int> &s;
+  ComparatorShape(CircuitShape &circuit, vector<unsigned int> &v) : c(circuit), s(v) {}
+  void operator () (unsigned int i, unsigned int j) {
+    unsigned int hi = c.Or(s[i], s[j]);
+    s[j] = c.And(s[i], s[j]);
+    s[i] = hi;
+    c.Share(s[i]);
+    c.Share(s[j]);
+  }
+};
+
+
+unsigned long Cardinality::SortingNetworkSize(unsigned int n, unsigned int m, unsigned long limit) {
+  CircuitShape c(limit);
+  vector<unsigned int> s(n);
+  for (unsigned int i = 0; i < n; i++)
+    s[i] = c.Input();
+
+  ComparatorShape comparator(c, s);
+  ForEachComparator(n, comparator);
+  return c.Clauses(s[m - 1]);
+}
+
+
+// -------------------------------------------------------------------
+
+
+static vector<unsigned int> AddersShape(CircuitShape &c, unsigned int n) {
+  if (n == 1)
+    return vector<unsigned int>(1, c.Input());
+
+  vector<unsigned int> a = AddersShape(c, n / 2);
+  vector<unsigned int> b = AddersShape(c, n - n / 2);
+  vector<unsigned int> r(Bits(n));
+
+  unsigned int carry = CircuitShape::False;
+  for (unsigned int i = 0; i < r.size(); i++) {
+    unsigned int u = (i < a.size() ? a[i] : (unsigned int)CircuitShape::False);
+    unsigned int v = (i < b.size() ? b[i] : (unsigned int)CircuitShape::False);
+    unsigned int uv = c.Xor(u, v);
+    r[i] = c.Xor(uv, carry);
+    if (i + 1 < r.size())
+      carry = c.Or(c.And(u, v), c.And(carry, uv));
+  }
+
+  return r;
+}
+
+
+// with the comparison of the count with m; below the lowest bit set in m
+// the comparison is true
+unsigned long Cardinality::AddersSize(unsigned int n, unsigned int m) {
+  CircuitShape c(ULONG_MAX);
+  vector<unsigned int> r = AddersShape(c, n);
+
+  unsigned int i = 0;
+  while (!((m >> i) & 1))
+    i++;
+  unsigned int g = r[i];
+  for (i++; i < r.size(); i++)
+    g = ((m >> i) & 1 ? c.And(r[i], g) : c.Or(r[i], g));
+  return c.Clauses(g);
+}
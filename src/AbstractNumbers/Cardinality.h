@@ -0,0 +1,82 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA.
+Authors: Milan Sesum and Predrag Janicic
+
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#ifndef __CARDINALITY_H
+#define __CARDINALITY_H
+
+#include <vector>
+#include "FormulaVector.h"
+
+using namespace std;
+
+
+////////////////////////////////////////////////////////////////////////////////
+////	Class Cardinality
+////////////////////////////////////////////////////////////////////////////////
+
+// Cardinality and pseudo-Boolean constraints over the formulas of a vector.
+// The number of true formulas is counted in unary, where the j-th output of
+// a counter is true iff at least j+1 of the formulas are true, or in binary,
+// by a tree of adders. The unary counter is a sequential counter, a
+// totalizer or an odd-even merge sorting network. The encoding with the
+// fewest clauses for the given number of formulas and outputs is chosen.
+// Weighted constraints are encoded as decision diagrams.
+// The encodings are circuits of AND, OR and XOR gates, so their clauses go
+// to the CNF sink together with the rest of the constraint. The gates used
+// by many others are shared (see Formula::SetShared), so each of them gets
+// its own variable and is not flattened into its users.
+
+class Cardinality {
+
+public:
+
+  // the first m outputs of a unary counter of the formulas of x (m <= size)
+  static FormulaVector Count(const FormulaVector &x, unsigned int m);
+  // the number of true formulas of x, as a number of the given width (at
+  // least the number of bits of the size of x)
+  static FormulaVector Sum(const FormulaVector &x, unsigned int width);
+  // Sum has fewer clauses than Count for n formulas and m outputs
+  static bool PreferSum(unsigned int n, unsigned int m);
+
+  static FormulaVector1 AtMost(const FormulaVector &x, unsigned int k);
+  static FormulaVector1 AtLeast(const FormulaVector &x, unsigned int k);
+  static FormulaVector1 Exactly(const FormulaVector &x, unsigned int k);
+
+  // the sum of the weights of the true formulas of x is at most k
+  static FormulaVector1 WeightedAtMost(const FormulaVector &x, const vector<unsigned long> &w, unsigned long k);
+
+private:
+
+  static FormulaVector SequentialCounter(const FormulaVector &x, unsigned int m);
+  static FormulaVector Totalizer(const FormulaVector &x, unsigned int from, unsigned int to, unsigned int m);
+  static FormulaVector SortingNetwork(const FormulaVector &x, unsigned int m);
+  // the bits of the count of x[from..to), the least significant first
+  static FormulaVector Adders(const FormulaVector &x, unsigned int from, unsigned int to);
+  // the count c given by Adders is at least t (t < 2^size of c)
+  static FormulaVector1 AtLeastBinary(const FormulaVector &c, unsigned long t);
+
+  // the estimated numbers of clauses of the encodings; those larger than
+  // the limit are not estimated, ULONG_MAX is returned instead
+  static unsigned long SequentialCounterSize(unsigned int n, unsigned int m, unsigned long limit);
+  static unsigned long TotalizerSize(unsigned int n, unsigned int m, unsigned long limit);
+  static unsigned long SortingNetworkSize(unsigned int n, unsigned int m, unsigned long limit);
+  static unsigned long AddersSize(unsigned int n, unsigned int m);
+
+  // calls f(i, j) for the comparators of the network, in order
+  template <class F> static void ForEachComparator(unsigned int n, F &f);
+};
+
+#endif
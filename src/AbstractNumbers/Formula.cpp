@@ -19,91 +19,129 @@ GNU General Public License for more details.
 
 unsigned int Formula::NEW = 0, Formula::DEL = 0;
 
-#include <unordered_set>
-#include <functional>
-using std::hash;
-
-#define MAGIC1 255
-#define MAGIC2 65535
-#define MAGIC3 16777215
-
-size_t compute_hash(enum FORMULA_TYPE type, bool val) { 
- // return std::hash<unsigned int>()((unsigned int)type) * MAGIC1 + std::hash<unsigned int>()((unsigned int)val) * MAGIC2;
-  return ((unsigned int)type) * MAGIC1 + ((unsigned int)val) * MAGIC1;
-} 
-
-size_t compute_hash(enum FORMULA_TYPE type, unsigned int o) { 
-//  return std::hash<unsigned int>()((unsigned int)type) * MAGIC1 + std::hash<unsigned int>()(o) * MAGIC2;
-  return ((unsigned int)type) * MAGIC1 + o * MAGIC2;
-} 
-
-size_t compute_hash(enum FORMULA_TYPE type, Formula *f) { 
-//  return std::hash<unsigned int>()((unsigned int)type) * MAGIC1 + std::hash<const char*>()((char*)f);
-  return ((unsigned int)type) * MAGIC1 + f->hashCode() * MAGIC2;
-} 
-
-size_t compute_hash(enum FORMULA_TYPE type, Formula *f1, Formula *f2) { 
-//  return std::hash<unsigned int>()((unsigned int)type) * MAGIC1 + std::hash<const char*>()((char*)f1) * MAGIC2 
- // + std::hash<const char*>()((char*)f2) * MAGIC2;
-  return ((unsigned int)type) * MAGIC1 + f1->hashCode() * MAGIC3 + f2->hashCode() * MAGIC3;
-}
-
 
 ////////////////////////////////////////////////////////////////////////////////
 ////	Class Formula
 ////////////////////////////////////////////////////////////////////////////////
 
 
-Formula::Formula() : refCount(0), m_bDefined(false) {  }
-
-Formula::Formula(FORMULA_TYPE t, size_t hV) : type(t), refCount(0), hashValue(hV), m_bDefined(false) {}
+FORMULA_TYPE Formula::GetType(void) const {
+  switch (FormulaFactory::Instance()->GetNodeType(GetNode())) {
+  case VAR :
+    return IsNegated() ? NOT : VAR;
+  case AND :
+    return IsNegated() ? OR : AND;
+  case XOR :
+    return IsNegated() ? EQUIV : XOR;
+  default :
+    return CONST;
+  }
+}
 
-FORMULA_TYPE Formula::GetType(void) { return type; }
+bool Formula::GetValue(void) const { return IsNegated(); }
 
-unsigned int Formula::GetId(void) { return id; }
-void Formula::SetId(unsigned int id) { this->id = id; }
+unsigned int Formula::GetOrdinal(void) const { return FormulaFactory::Instance()->GetNodeLeft(GetNode()); }
 
-void Formula::IncRefCount(void) { ++refCount; }
-void Formula::DecRefCount(void) { --refCount; }
+Formula Formula::GetF(void) const { return ~(*this); }
 
-unsigned int Formula::GetRefCount(void) { return refCount; }
+// OR(~l, ~r) is the negation of AND(l, r), EQUIV(l, r) of XOR(l, r)
+Formula Formula::GetLeftF(void) const {
+  Formula l(FormulaFactory::Instance()->GetNodeLeft(GetNode()));
+  return (GetType() == OR) ? ~l : l;
+}
 
-size_t Formula::hashCode() const { return hashValue; }
+Formula Formula::GetRightF(void) const {
+  Formula r(FormulaFactory::Instance()->GetNodeRight(GetNode()));
+  return (GetType() == OR) ? ~r : r;
+}
 
-bool Formula::operator == (const Formula& f) const {
-  if (type != f.type)
-    return false;
-  return equals(f);
+int Formula::GetId(void) const {
+  int id = FormulaFactory::Instance()->GetNodeId(GetNode());
+  return IsNegated() ? -id : id;
 }
 
+void Formula::IncRefCount(void) const { FormulaFactory::Instance()->IncNodeRefCount(GetNode()); }
+void Formula::DecRefCount(void) const { FormulaFactory::Instance()->DecNodeRefCount(GetNode()); }
 
-// assuming that f is in FormulaFactory
-Formula* Formula::makeNot(Formula *f) {
+unsigned int Formula::GetRefCount(void) const { return FormulaFactory::Instance()->GetNodeRefCount(GetNode()); }
 
-  Formula *tmp;
-  if (f->GetType() == CONST) {
-    if (((FormulaConst*)f)->GetValue() == true)
-      tmp = new FormulaNT();
-    else
-      tmp = new FormulaT();
+bool Formula::IsDefined(void) const { return FormulaFactory::Instance()->IsNodeDefined(GetNode()); }
+void Formula::SetDefined(void) const { FormulaFactory::Instance()->SetNodeDefined(GetNode()); }
+void Formula::SetShared(void) const { FormulaFactory::Instance()->SetNodeShared(GetNode()); }
+
+
+void Formula::print(void) const {
 
-    FormulaFactory::Instance()->Remove(f);
+  Formula l, r;
+  switch (GetType()) {
+  case CONST :
+    cout << GetValue();
+    return;
+  case VAR :
+    cout << " v" << GetOrdinal() << " ";
+    return;
+  case NOT :
+    cout << " ~";
+    GetF().print();
+    return;
+  default :
+    break;
   }
-  else
-    tmp = new FormulaNot(f);
 
-  Formula::NEW++;
-  return FormulaFactory::Instance()->Get(tmp);
+  l = GetLeftF();
+  r = GetRightF();
+
+  if (l.GetType() == VAR)
+    l.print();
+  else {
+    cout << " (";
+    l.print();
+    cout << ") ";
+  }
+
+  switch (GetType()) {
+  case AND :
+    cout << " & ";
+    break;
+  case OR :
+    cout << " | ";
+    break;
+  case XOR :
+    cout << " ^ ";
+    break;
+  case EQUIV :
+    cout << " <=> ";
+    break;
+  default: break;
+  }
+
+  if (r.GetType() == VAR)
+    r.print();
+  else {
+    cout << " (";
+    r.print();
+    cout << ") ";
+  }
+}
+
+
+// negation does not create a node
+Formula Formula::makeNot(Formula f) {
+  return ~f;
 }
 
 
 // assuming that f1 and f2 are in FormulaFactory
-Formula* Formula::makeOr(Formula *f1, Formula *f2) {
+Formula Formula::makeOr(Formula f1, Formula f2) {
 
   if (f1 == f2)
     return f1;
-  else if (f1->GetType() == CONST) {
-    if (((FormulaConst*)f1)->GetValue() == false) {
+  else if (f1 == ~f2) {
+    FormulaFactory::Instance()->Remove(f1);
+    return FormulaFactory::Instance()->GetConst(true);
+  }
+  else if (f1.GetType() == CONST) {
+    if (f1.GetValue() == false) {
       FormulaFactory::Instance()->Remove(f1);
       return f2;
     }
@@ -112,8 +150,8 @@ Formula* Formula::makeOr(Formula *f1, Formula *f2) {
       return f1; // true
     }
   }
-  else if (f2->GetType() == CONST) {
-    if (((FormulaConst*)f2)->GetValue() == false) {
+  else if (f2.GetType() == CONST) {
+    if (f2.GetValue() == false) {
       FormulaFactory::Instance()->Remove(f2);
       return f1;
     }
@@ -122,23 +160,24 @@ Formula* Formula::makeOr(Formula *f1, Formula *f2) {
       return f2; // true
     }
   }
-  else {
-    Formula::NEW++;
-    return FormulaFactory::Instance()->Get(new FormulaOr(f1, f2));
-  }
+  else
+    return FormulaFactory::Instance()->GetBinary(OR, f1, f2);
 }
 
 // assuming that f1 and f2 are in FormulaFactory
-Formula* Formula::makeXor(Formula *f1, Formula *f2) {
+Formula Formula::makeXor(Formula f1, Formula f2) {
 
-  Formula *tmp;
+  Formula tmp;
   if (f1 == f2) {
-    Formula::NEW++;
     FormulaFactory::Instance()->Remove(f1);
-    return FormulaFactory::Instance()->Get(new FormulaNT());
+    return FormulaFactory::Instance()->GetConst(false);
   }
-  else if (f1->GetType() == CONST) {
-    if (((FormulaConst*)f1)->GetValue() == false)
+  else if (f1 == ~f2) {
+    FormulaFactory::Instance()->Remove(f1);
+    return FormulaFactory::Instance()->GetConst(true);
+  }
+  else if (f1.GetType() == CONST) {
+    if (f1.GetValue() == false)
       tmp = f2;
     else 
       tmp = makeNot(f2);
@@ -146,8 +185,8 @@ Formula* Formula::makeXor(Formula *f1, Formula *f2) {
     FormulaFactory::Instance()->Remove(f1);
     return tmp;
   }
-  else if (f2->GetType() == CONST) {
-    if (((FormulaConst*)f2)->GetValue() == false)
+  else if (f2.GetType() == CONST) {
+    if (f2.GetValue() == false)
       tmp = f1;
     else
       tmp = makeNot(f1);
@@ -155,24 +194,25 @@ Formula* Formula::makeXor(Formula *f1, Formula *f2) {
     FormulaFactory::Instance()->Remove(f2);
     return tmp;
   }
-  else {
-    Formula::NEW++;
-    return FormulaFactory::Instance()->Get(new FormulaXor(f1, f2));
-  }
+  else
+    return FormulaFactory::Instance()->GetBinary(XOR, f1, f2);
 }
 
 
 // assuming that f1 and f2 are in FormulaFactory
-Formula* Formula::makeEquiv(Formula *f1, Formula *f2) {
+Formula Formula::makeEquiv(Formula f1, Formula f2) {
 
-  Formula *tmp;
+  Formula tmp;
   if (f1 == f2) {
-    Formula::NEW++;
     FormulaFactory::Instance()->Remove(f1);
-    return FormulaFactory::Instance()->Get(new FormulaT());
+    return FormulaFactory::Instance()->GetConst(true);
   }
-  else if (f1->GetType() == CONST) {
-    if (((FormulaConst*)f1)->GetValue() == false)
+  else if (f1 == ~f2) {
+    FormulaFactory::Instance()->Remove(f1);
+    return FormulaFactory::Instance()->GetConst(false);
+  }
+  else if (f1.GetType() == CONST) {
+    if (f1.GetValue() == false)
       tmp = makeNot(f2);
     else 
       tmp = f2;
@@ -180,8 +220,8 @@ Formula* Formula::makeEquiv(Formula *f1, Formula *f2) {
     FormulaFactory::Instance()->Remove(f1);
     return tmp;
   }
-  else if (f2->GetType() == CONST) {
-    if (((FormulaConst*)f2)->GetValue() == false)
+  else if (f2.GetType() == CONST) {
+    if (f2.GetValue() == false)
       tmp = makeNot(f1);
     else
       tmp = f1;
@@ -189,21 +229,23 @@ Formula* Formula::makeEquiv(Formula *f1, Formula *f2) {
     FormulaFactory::Instance()->Remove(f2);
     return tmp;
   }
-  else {
-    Formula::NEW++;
-    return FormulaFactory::Instance()->Get(new FormulaEquiv(f1, f2));
-  }
+  else
+    return FormulaFactory::Instance()->GetBinary(EQUIV, f1, f2);
 }
 
 
 
 // assuming that f1 and f2 are in FormulaFactory
-Formula* Formula::makeAnd(Formula *f1, Formula *f2) {
+Formula Formula::makeAnd(Formula f1, Formula f2) {
 
   if (f1 == f2)
     return f1;
-  else if (f1->GetType() == CONST) {
-    if (((FormulaConst*)f1)->GetValue() == false) {
+  else if (f1 == ~f2) {
+    FormulaFactory::Instance()->Remove(f1);
+    return FormulaFactory::Instance()->GetConst(false);
+  }
+  else if (f1.GetType() == CONST) {
+    if (f1.GetValue() == false) {
       FormulaFactory::Instance()->Remove(f2);
       return f1;
     }
@@ -212,8 +254,8 @@ Formula* Formula::makeAnd(Formula *f1, Formula *f2) {
       return f2;
     }
   }
-  else if (f2->GetType() == CONST) {
-    if (((FormulaConst*)f2)->GetValue() == false) {
+  else if (f2.GetType() == CONST) {
+    if (f2.GetValue() == false) {
       FormulaFactory::Instance()->Remove(f1);
       return f2;
     }
@@ -222,185 +264,6 @@ Formula* Formula::makeAnd(Formula *f1, Formula *f2) {
       return f1;
     }
   }
-  else {
-    Formula::NEW++;
-    return FormulaFactory::Instance()->Get(new FormulaAnd(f1, f2));
-  }
-}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaConst
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaConst::FormulaConst(bool val) : Formula(CONST, compute_hash(CONST, val)), value(val) {}
-
-bool FormulaConst::GetValue(void) { return value; }
-
-bool FormulaConst::equals(const Formula& f) const {
-  return value == ((FormulaConst&)f).value;
-}
-
-void FormulaConst::print(void) { cout << value;}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaT
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaT::FormulaT() : FormulaConst(true) {}
-
-//void FormulaT::print(void) { cout << "1"; }
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaNT
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaNT::FormulaNT() : FormulaConst(false) {}
-
-//void FormulaNT::print(void) { cout << "0"; }
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaVar
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaVar::FormulaVar(unsigned int o) : Formula(VAR, compute_hash(VAR,o)), ordinal(o) {}
-
-void FormulaVar::print(void) { cout << " v" << ordinal << " "; }
-
-unsigned int FormulaVar::GetOrdinal(void) { return ordinal; }
-
-bool FormulaVar::equals(const Formula& f) const {
-  return ordinal == ((FormulaVar&)f).ordinal;
-}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaNot
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaNot::FormulaNot(Formula *f) : Formula(NOT, compute_hash(NOT,f)), F(f) {
-  f->IncRefCount();
-}
-
-FormulaNot::~FormulaNot() {
-
-  F->DecRefCount();
-  FormulaFactory::Instance()->Remove(F);
-}
-
-void FormulaNot::print(void) {
-
-  if (F->GetType() == VAR) {
-    cout << " ~";
-    F->print();
-  }
-  else {
-    cout << " ~(";
-    F->print();
-    cout << ")";
-  }
-}
-
-Formula* FormulaNot::GetF(void) { return F; }
-
-bool FormulaNot::equals(const Formula& f) const {
-  return F == ((FormulaNot&)f).F;
-}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaBinary
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaBinary::FormulaBinary(Formula *f1, Formula *f2, FORMULA_TYPE type) : Formula(type, compute_hash(type,f1,f2)), leftF(f1), rightF(f2) {
-  leftF->IncRefCount();
-  rightF->IncRefCount();
-}
-
-FormulaBinary::~FormulaBinary() {
-
-  leftF->DecRefCount();
-  FormulaFactory::Instance()->Remove(leftF);
-  rightF->DecRefCount();
-  FormulaFactory::Instance()->Remove(rightF);
-}
-
-Formula* FormulaBinary::GetLeftF(void) { return leftF; }
-
-Formula* FormulaBinary::GetRightF(void) { return rightF; }
-
-bool FormulaBinary::equals(const Formula& f) const {
-  return (leftF == ((FormulaBinary&)f).leftF && rightF == ((FormulaBinary&)f).rightF) || 
-         (leftF == ((FormulaBinary&)f).rightF && rightF == ((FormulaBinary&)f).leftF);
-}
-
-void FormulaBinary::print(void) {
-
-  if (leftF->GetType() == VAR)
-    leftF->print();
-  else {
-    cout << " (";
-    leftF->print();
-    cout << ") ";
-  }
-
-  switch (type) {
-  case AND :
-    cout << " & ";
-    break;
-  case OR :
-    cout << " | ";
-    break;
-  case XOR :
-    cout << " ^ ";
-    break;
-  case EQUIV :
-    cout << " <=> ";
-    break;
-  default: break;
-  }
-
-  if (rightF->GetType() == VAR)
-    rightF->print();
-  else {
-    cout << " (";
-    rightF->print();
-    cout << ") ";
-  }
+  else
+    return FormulaFactory::Instance()->GetBinary(AND, f1, f2);
 }
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaAnd
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaAnd::FormulaAnd(Formula *f1, Formula *f2) : FormulaBinary(f1, f2, AND) {}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaOr
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaOr::FormulaOr(Formula *f1, Formula *f2) : FormulaBinary(f1, f2, OR) {}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaXor
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaXor::FormulaXor(Formula *f1, Formula *f2) : FormulaBinary(f1, f2, XOR) {}
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaEquiv
-////////////////////////////////////////////////////////////////////////////////
-
-FormulaEquiv::FormulaEquiv(Formula *f1, Formula *f2) : FormulaBinary(f1, f2, EQUIV) {}
-
-
-
-
-
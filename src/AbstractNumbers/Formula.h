@@ -3,12 +3,12 @@ URSA -- Copyright (c) 2010, Predrag Janicic
 
 This file is part of URSA.
 Authors: Milan Sesum and Predrag Janicic
- 
+
 URSA is free software; you can redistribute it and/or modify
 it under the terms of the GNU General Public License as published by
 the Free Software Foundation; either version 2 of the License, or
 (at your option) any later version.
- 
+
 URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
 MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 GNU General Public License for more details.
@@ -42,203 +42,67 @@ enum FORMULA_TYPE {
 ////	Class Formula
 ////////////////////////////////////////////////////////////////////////////////
 
-class Formula {
-
-public:
-
-  virtual ~Formula() {}
-
-  virtual void print(void) = 0;
-
-  FORMULA_TYPE GetType(void);
-
-  unsigned int GetId(void);
-  void SetId(unsigned int id);
-
-  void IncRefCount(void);
-  void DecRefCount(void);
-
-  unsigned int GetRefCount(void);
-
-  virtual bool equals(const Formula& f) const = 0;
-  bool operator == (const Formula& f) const;
-
-  size_t hashCode() const;
-
-  static unsigned int I, D, NEW, DEL;
-
-  static Formula* makeNot(Formula*);
-  static Formula* makeOr(Formula*, Formula*);
-  static Formula* makeXor(Formula*, Formula*);
-  static Formula* makeAnd(Formula*, Formula*);
-  static Formula* makeEquiv(Formula*, Formula*);
-
-  bool IsDefined() { return m_bDefined; }
-  void SetDefined() { m_bDefined=true; }
-
-protected:
-  FORMULA_TYPE type;
-  unsigned int refCount;
-  unsigned int id;
-  size_t hashValue;
-  
-  unsigned int m_bDefined;
-
-  Formula();
-
-  Formula(FORMULA_TYPE type, size_t hashValue);
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaConst
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaConst : public Formula {
+// A formula is a literal: the index of a node in the FormulaFactory node
+// store shifted left by one, with the lowest bit set if the node is negated.
+// Only CONST, VAR, AND and XOR nodes are stored; negations are complemented
+// literals, OR is a complemented AND with complemented operands and EQUIV is
+// a complemented XOR. GetType() and the accessors present these views, so
+// a negated VAR is seen as NOT, a negated AND as OR and a negated XOR as
+// EQUIV. Node 0 is the constant false, hence literal 1 is true.
 
-public:
-
-  FormulaConst(bool value);
-  bool GetValue(void);
-  bool equals(const Formula& f) const;
-  void print(void);
-
-protected:
-
-  bool value;
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaT
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaT : public FormulaConst {
-
-public:
-
-  FormulaT();
-
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaNT
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaNT : public FormulaConst {
+class Formula {
 
 public:
 
-  FormulaNT();
+  Formula() : literal(0) {}
+  explicit Formula(unsigned int l) : literal(l) {}
 
-};
+  unsigned int GetLiteral(void) const { return literal; }
+  unsigned int GetNode(void) const { return literal >> 1; }
+  bool IsNegated(void) const { return literal & 1; }
 
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaVar
-////////////////////////////////////////////////////////////////////////////////
+  bool operator == (const Formula& f) const { return literal == f.literal; }
+  bool operator != (const Formula& f) const { return literal != f.literal; }
+  Formula operator ~ () const { return Formula(literal ^ 1); }
 
-class FormulaVar : public Formula {
+  void print(void) const;
 
-public:
+  FORMULA_TYPE GetType(void) const;
 
-  FormulaVar(unsigned int o);
-  void print(void);
-  unsigned int GetOrdinal(void);
-  bool equals(const Formula& f) const;
+  // CONST
+  bool GetValue(void) const;
+  // VAR
+  unsigned int GetOrdinal(void) const;
+  // NOT
+  Formula GetF(void) const;
+  // AND, OR, XOR, EQUIV
+  Formula GetLeftF(void) const;
+  Formula GetRightF(void) const;
 
-private:
+  // the id of the node, negative for a negated node
+  int GetId(void) const;
 
-  unsigned int ordinal;
-};
+  void IncRefCount(void) const;
+  void DecRefCount(void) const;
 
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaNot
-////////////////////////////////////////////////////////////////////////////////
+  unsigned int GetRefCount(void) const;
 
-class FormulaNot : public Formula {
+  bool IsDefined(void) const;
+  void SetDefined(void) const;
+  // the formula is used by many gates: it is defined once in the CNF,
+  // and not flattened into the ANDs (ORs) using it
+  void SetShared(void) const;
 
-public:
+  static unsigned int I, D, NEW, DEL;
 
-  FormulaNot(Formula *f);
-  ~FormulaNot();
-  void print(void);
-  Formula* GetF(void);
-  bool equals(const Formula& f) const;
+  static Formula makeNot(Formula);
+  static Formula makeOr(Formula, Formula);
+  static Formula makeXor(Formula, Formula);
+  static Formula makeAnd(Formula, Formula);
+  static Formula makeEquiv(Formula, Formula);
 
 private:
-
-  Formula *F;
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaBinary
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaBinary : public Formula {
-
-public:
-
-  FormulaBinary(Formula *f1, Formula *f2, FORMULA_TYPE type);
-  virtual ~FormulaBinary();
-  Formula* GetLeftF(void);
-  Formula* GetRightF(void);
-  bool equals(const Formula& f) const;
-  void print(void);
-
-protected:
-
-  Formula *leftF, *rightF;
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaAnd
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaAnd : public FormulaBinary {
-
-public:
-
-  FormulaAnd(Formula *f1, Formula *f2);
-  ~FormulaAnd() {}
-
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaOr
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaOr : public FormulaBinary {
-
-public:
-
-  FormulaOr(Formula *f1, Formula *f2);
-  ~FormulaOr() {}
-
-};
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaXor
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaXor : public FormulaBinary {
-
-public:
-
-  FormulaXor(Formula *f1, Formula *f2);
-  ~FormulaXor() {}
-
-};
-
-
-////////////////////////////////////////////////////////////////////////////////
-////	Class FormulaEquiv
-////////////////////////////////////////////////////////////////////////////////
-
-class FormulaEquiv : public FormulaBinary {
-
-public:
-
-  FormulaEquiv(Formula *f1, Formula *f2);
-  ~FormulaEquiv() {}
-
+  unsigned int literal;
 };
 
 #endif
@@ -24,19 +24,63 @@ GNU General Public License for more details.
 
 FormulaFactory *FormulaFactory::formulaFactory = 0;
 
+// the key is packed into 64 bits and mixed by the finalizer of MurmurHash3,
+// so that every bit of the key affects every bit of the hash
+unsigned int FormulaFactory::Hash(unsigned int type, unsigned int left, unsigned int right) {
+  unsigned long long h = ((unsigned long long)left << 32 | right) ^ ((unsigned long long)type << 61);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return (unsigned int)(h ^ (h >> 32));
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+  FormulaFactory::FormulaFactory() : bPolarityAware(false), bNativeXor(false), cnfSink(0), bStatistics(false) {
+    Clear();
+  }
+
+
+// ----------------------------------------------------------------------------
+
+
+  void FormulaFactory::Clear() {
+
+    existingFormulas.Clear();
+    types.clear();
+    flags.clear();
+    lefts.clear();
+    rights.clear();
+    refCounts.clear();
+    ids.clear();
+    freeNodes.clear();
+    Formula::NEW = Formula::DEL = 0;
+    refCountUpdates = vectorAllocations = nodeAllocations = 0;
+
+    // node 0 is the constant false and is never removed
+    types.push_back(CONST);
+    flags.push_back(0);
+    lefts.push_back(0);
+    rights.push_back(0);
+    refCounts.push_back(0);
+    ids.push_back(0);
+  }
+
 
 // ----------------------------------------------------------------------------
 
 
   void FormulaFactory::print(void) {
 
-    FormulaPointerSet::iterator b = begin(), e = end(), i;
     int k = 0;
-    for (i = b; i != e; i++, k++) {
-      Formula *f = *i;
-      if (f && f->GetRefCount() == 0) {
-        cout << endl << k + 1 << ". RC = " << f->GetRefCount() << " " << f->GetType() << endl;
-        f->print();
+    for (unsigned int n = 1; n < types.size(); n++) {
+      if (types[n] != CONST && refCounts[n] == 0) {
+        cout << endl << ++k << ". RC = " << refCounts[n] << " " << (int)types[n] << endl;
+        Formula(n << 1).print();
       }
     }
   }
@@ -46,22 +90,89 @@ FormulaFactory *FormulaFactory::formulaFactory = 0;
 // ----------------------------------------------------------------------------
 
 
+  void FormulaFactory::PrintStatistics(void) {
 
-  Formula* FormulaFactory::Get(Formula *f) {
+    cout << "[Unique table: " << existingFormulas.GetCount() << " formulas, load factor "
+         << existingFormulas.GetLoadFactor() << ", average probe length " 
+         << existingFormulas.GetAverageProbeLength() << ", longest probe "
+         << existingFormulas.GetLongestProbe() << ", collisions "
+         << existingFormulas.GetCollisions() << "]" << endl;
+    cout << "[Reference counts: " << Formula::NEW << " nodes created, " << refCountUpdates
+         << " updates (" << (Formula::NEW ? (double)refCountUpdates/Formula::NEW : 0) << " per node)]" << endl;
+    cout << "[Allocations: " << vectorAllocations << " formula vectors on the heap, "
+         << nodeAllocations << " growths of the node arrays]" << endl;
+  }
 
-    FormulaPointerSet::const_iterator i = existingFormulas.find(f);
 
-    if ( i != existingFormulas.end() ) {
-      if (*i != f) {
-        Formula::DEL++;
-      	delete f;
-      }
-      return *i;
+
+// ----------------------------------------------------------------------------
+
+
+
+  Formula FormulaFactory::MakeNode(FORMULA_TYPE type, unsigned int left, unsigned int right) {
+
+    // operands of AND and XOR are ordered, so both orders give the same key
+    if (type != VAR && left > right) {
+      unsigned int tmp = left;
+      left = right;
+      right = tmp;
+    }
+
+    unsigned int hash = Hash(type, left, right);
+    unsigned int n = existingFormulas.Find(hash, type, left, right);
+    if (n)
+      return Formula(n << 1);
+
+    if (!freeNodes.empty()) {
+      n = freeNodes.back();
+      freeNodes.pop_back();
+      types[n] = type;
+      flags[n] = 0;
+      lefts[n] = left;
+      rights[n] = right;
+      refCounts[n] = 0;
+      ids[n] = 0;
     }
     else {
-      existingFormulas.insert(f);
-      return f;
+      n = types.size();
+      if (bStatistics && types.size() == types.capacity())
+        nodeAllocations++;
+      types.push_back(type);
+      flags.push_back(0);
+      lefts.push_back(left);
+      rights.push_back(right);
+      refCounts.push_back(0);
+      ids.push_back(0);
     }
+
+    if (type != VAR) {
+      ++refCounts[left >> 1];
+      ++refCounts[right >> 1];
+    }
+
+    existingFormulas.Insert(hash, type, left, right, n);
+    Formula::NEW++;
+    return Formula(n << 1);
+  }
+
+
+
+// ----------------------------------------------------------------------------
+
+
+
+  Formula FormulaFactory::GetConst(bool value) {
+    return Formula(value ? 1 : 0);
+  }
+
+
+
+// ----------------------------------------------------------------------------
+
+
+
+  Formula FormulaFactory::GetVar(unsigned int ordinal) {
+    return MakeNode(VAR, ordinal, 0);
   }
 
 
@@ -70,19 +181,64 @@ FormulaFactory *FormulaFactory::formulaFactory = 0;
 
 
 
-  void FormulaFactory::Remove(Formula *f) {
+  Formula FormulaFactory::GetBinary(FORMULA_TYPE type, Formula f1, Formula f2) {
+
+    unsigned int l = f1.GetLiteral(), r = f2.GetLiteral(), neg;
+    switch (type) {
+      case AND :
+        return MakeNode(AND, l, r);
+      case OR :
+        return ~MakeNode(AND, l ^ 1, r ^ 1);
+      case XOR :
+      case EQUIV :
+        // negations are moved out of XOR, so both operands are positive
+        assert((l | 1) != (r | 1));
+        neg = (l ^ r ^ (type == EQUIV)) & 1;
+        l &= ~1u;
+        r &= ~1u;
+        return neg ? ~MakeNode(XOR, l, r) : MakeNode(XOR, l, r);
+      default :
+        assert(false);
+        return GetConst(false);
+    }
+  }
+
+
+
+// ----------------------------------------------------------------------------
+
+
 
-    //		assert(f != 0);
+  void FormulaFactory::Remove(Formula f) {
 
-    if (f->GetRefCount())
+    unsigned int n = f.GetNode();
+    if (types[n] == CONST || refCounts[n])
       return;
 
-    //		assert(existingFormulas.find(f) != existingFormulas.end());
-    if (existingFormulas.find(f) != existingFormulas.end())
-      existingFormulas.erase(f);
+    // subformulas are released by the factory, the node itself keeps no
+    // references; an explicit stack of (node, number of operands released)
+    // is used, as formulas can be very deep
+    removeStack.push_back(make_pair(n, 0));
+    while (!removeStack.empty()) {
+      n = removeStack.back().first;
+      unsigned int released = removeStack.back().second++;
+
+      if (released == 0)
+        existingFormulas.Erase(Hash(types[n], lefts[n], rights[n]), types[n], lefts[n], rights[n]);
+
+      if (types[n] != VAR && released < 2) {
+        unsigned int g = (released == 0 ? lefts[n] : rights[n]) >> 1;
+        if (--refCounts[g] == 0 && types[g] != CONST)
+          removeStack.push_back(make_pair(g, 0));
+        continue;
+      }
 
-    delete f;
-    Formula::DEL++;
+      types[n] = CONST;
+      flags[n] = 0;
+      freeNodes.push_back(n);
+      Formula::DEL++;
+      removeStack.pop_back();
+    }
   }
 
 
@@ -93,14 +249,11 @@ FormulaFactory *FormulaFactory::formulaFactory = 0;
 
   void FormulaFactory::SetIds(int *varCount) {
 
-    FormulaPointerSet::iterator iter;
-    for (iter = begin(); iter != end(); iter++)
-      if ((*iter)->GetType() == VAR) {
-        (*iter)->SetId(((FormulaVar*)(*iter))->GetOrdinal());
-      }
-      else if ((*iter)->GetType() != CONST) {
-        (*iter)->SetId(++(*varCount));
-      }
+    for (unsigned int n = 1; n < types.size(); n++)
+      if (types[n] == VAR)
+        ids[n] = lefts[n];
+      else if (types[n] != CONST)
+        ids[n] = ++(*varCount);
   }
 
 
@@ -108,135 +261,226 @@ FormulaFactory *FormulaFactory::formulaFactory = 0;
 
 
   // f is either T or NT or does not includes nor T neither NT
-  bool FormulaFactory::GenerateCNF(FormulaVector constraint, vector<vector<int> >& conj, unsigned int* pMappedVarId, int* varCount) {
+  bool FormulaFactory::CountCNF(FormulaVector constraint, unsigned int* pMappedVarId, int* varCount, unsigned long* clauseCount) {
     assert(constraint.getSize()==1);
 
-    Formula* root=constraint.getFormulaFrom(0);
+    Formula root=constraint.getFormulaFrom(0);
 
-    if (root->GetType() == CONST) {
-    	if (((FormulaConst*)root)->GetValue() == false) {
+    cnfClauses = cnfSkipped = 0;
+    if (root.GetType() == CONST) {
+    	if (root.GetValue() == false) {
         // cerr << "The constraint is trivially false!" << endl;
         return false;
       }
     }
 
-    vector<Formula*> top_conjuncts;
+    cnfSink = 0;
+    if (bNativeXor)
+      CountUses(root);
+    TraverseConjuncts(root);
+
+    unsigned int ReducedVars=0;
+    for (unsigned int n = 1; n < types.size(); n++) {
+      if (flags[n] & DEFINED) {
+        pMappedVarId[ids[n]]=++ReducedVars; 
+        // cout << "var " << ids[n] << " -> " << ReducedVars << endl; 
+      }
+    }
+    *varCount = ReducedVars;
+    *clauseCount = cnfClauses;
+
+    return true;
+  }
+
+
+// ----------------------------------------------------------------------------
+
+
+  // the same traversal as in CountCNF, now giving the clauses to the sink
+  void FormulaFactory::GenerateCNF(FormulaVector constraint, unsigned int* pMappedVarId, ClauseSink& sink) {
+    assert(constraint.getSize()==1);
+
+    cnfSink = &sink;
+    cnfMap = pMappedVarId;
+    cnfClauses = cnfSkipped = 0;
+    TraverseConjuncts(constraint.getFormulaFrom(0));
+    cnfSink = 0;
+  }
+
+
+// ----------------------------------------------------------------------------
+
+
+  void FormulaFactory::TraverseConjuncts(Formula root) {
+
+    for (unsigned int n = 0; n < flags.size(); n++)
+      flags[n] &= ~BOTH;
+
+    // the constraint is asserted, so its conjuncts occur positively
+    unsigned char polarity = (bPolarityAware ? POSITIVE : BOTH);
+
+    vector<Formula> top_conjuncts;
     GatherConjuncts(root,top_conjuncts);
 
-    vector<int> disj,args;
-    vector<vector<int> > conj_tmp;
-    vector<Formula*>::iterator jt;
+    vector<int> disj;
+    vector<Formula>::iterator jt;
     for (jt = top_conjuncts.begin(); jt != top_conjuncts.end(); jt++) {
       if(IsClause(*jt)) {
-        TraverseNaryConnectives(*jt,OR,args,conj_tmp);
-        for (unsigned int i=0; i<args.size(); i++)  
-          disj.push_back(args[i]);
-        conj_tmp.push_back(disj);
-        disj.clear();
-        args.clear();
+        PushCNFTask(CNFTask::CLAUSE, *jt, OR, polarity);
+        PushOperands(*jt, OR, polarity);
       }
       else {
-        disj.push_back(((Formula*)*jt)->GetId());
-        conj_tmp.push_back(disj);
+        disj.push_back(jt->GetId());
+        EmitClause(disj);
         disj.clear();
-        TraverseFormulaTreeAndGenerateCNF(((Formula*)*jt),conj_tmp);
+        PushCNFTask(CNFTask::VISIT, *jt, CONST, polarity);
       }
+      TraverseFormulaTreeAndGenerateCNF();
     }
+  }
 
-    FormulaPointerSet::iterator it;
-    unsigned int ReducedVars=0;
-    for (it = FormulaFactory::Instance()->begin(); it != FormulaFactory::Instance()->end(); it++) {
-      Formula *f = *it;
-      if (f->IsDefined()) {
-        pMappedVarId[f->GetId()]=++ReducedVars; 
-        // cout << "var " << f->GetId() << " -> " << ReducedVars << " defined:" << f->IsDefined() << endl; 
-      }
-    }
-    *varCount = ReducedVars;
 
-    vector<int> clause; 
-    int mappedVar;   
-    for (vector<vector<int> >::iterator iter_c = conj_tmp.begin(); iter_c != conj_tmp.end(); iter_c++) {
-      for (vector<int>::iterator iter_d = iter_c->begin(); iter_d != iter_c->end(); iter_d++) {
-        mappedVar = ( *iter_d>0 ? pMappedVarId[*iter_d] : -pMappedVarId[-(*iter_d)]);
-        clause.push_back(mappedVar);
-      }
-      conj.push_back(clause);
-      clause.clear();
-    }
+// ----------------------------------------------------------------------------
 
-    return true;
+
+  void FormulaFactory::EmitClause(vector<int> & disj) {
+
+    cnfClauses++;
+    if (!cnfSink)
+      return;
+
+    for (vector<int>::iterator it = disj.begin(); it != disj.end(); it++)
+      *it = ( *it>0 ? cnfMap[*it] : -cnfMap[-(*it)]);
+    cnfSink->addClause(disj);
   }
 
 
 // ----------------------------------------------------------------------------
 
 
-  void FormulaFactory::GatherConjuncts(Formula* f, vector<Formula*> & args) {
-    if(f->GetType()==AND) {
-      GatherConjuncts(((FormulaAnd*)f)->GetLeftF(), args);
-      GatherConjuncts(((FormulaAnd*)f)->GetRightF(), args);
-    }
-    else 
-      args.push_back(f);
+  void FormulaFactory::EmitXorClause(vector<int> & disj) {
+
+    cnfClauses++;
+    if (!cnfSink)
+      return;
+
+    for (vector<int>::iterator it = disj.begin(); it != disj.end(); it++)
+      *it = ( *it>0 ? cnfMap[*it] : -cnfMap[-(*it)]);
+    cnfSink->addXorClause(disj);
   }
 
 
 // ----------------------------------------------------------------------------
 
 
-  void FormulaFactory::TraverseNaryConnectives(Formula* f, FORMULA_TYPE type, vector<int> & args,vector<vector <int> > & conj_tmp) {
-    if(f->GetType()==type && type==OR) {
-      TraverseNaryConnectives(((FormulaOr*)f)->GetLeftF(), type, args, conj_tmp);
-      TraverseNaryConnectives(((FormulaOr*)f)->GetRightF(), type, args, conj_tmp);
-      return;
-    }
- 
-    if(f->GetType()==type && type==AND) {
-      TraverseNaryConnectives(((FormulaAnd*)f)->GetLeftF(), type, args, conj_tmp);
-      TraverseNaryConnectives(((FormulaAnd*)f)->GetRightF(), type, args, conj_tmp);
-      return;
-    }
+  // a XOR node used by a single XOR node is a part of its chain and needs
+  // no variable of its own
+  void FormulaFactory::CountUses(Formula root) {
 
-    if(f->GetType()==VAR) {
-      f->SetDefined();
-      args.push_back(f->GetId());
+    cnfUses.assign(types.size(), 0);
+    xorStack.clear();
+
+    cnfUses[root.GetNode()] += 2;
+    xorStack.push_back(root.GetNode());
+    while (!xorStack.empty()) {
+      unsigned int n = xorStack.back();
+      xorStack.pop_back();
+      if (types[n] != AND && types[n] != XOR)
+        continue;
+
+      unsigned int use = (types[n] == XOR ? 1 : 2);
+      unsigned int operands[2] = { lefts[n] >> 1, rights[n] >> 1 };
+      for (int i = 0; i < 2; i++) {
+        if (cnfUses[operands[i]] == 0)
+          xorStack.push_back(operands[i]);
+        cnfUses[operands[i]] += use;
+      }
     }
-    else if(f->GetType()==NOT) {
-      int level;
-      Formula *a = GoThroughNegations(f, &level);
-      args.push_back(level % 2 ? -a->GetId() : a->GetId());
-      TraverseFormulaTreeAndGenerateCNF(a,conj_tmp);
+  }
+
+
+// ----------------------------------------------------------------------------
+
+
+  // the node of f is defined by one xor clause over the leaves of its chain;
+  // leaves that occur an even number of times cancel out
+  void FormulaFactory::DefineXorChain(Formula f) {
+
+    unsigned int n = f.GetNode();
+    bool negated = false;
+
+    xorStack.clear();
+    xorLeaves.clear();
+    xorStack.push_back(lefts[n]);
+    xorStack.push_back(rights[n]);
+    while (!xorStack.empty()) {
+      unsigned int l = xorStack.back();
+      unsigned int m = l >> 1;
+      xorStack.pop_back();
+      if (l & 1)
+        negated = !negated;
+
+      if (types[m] == XOR && cnfUses[m] == 1) {
+        xorStack.push_back(lefts[m]);
+        xorStack.push_back(rights[m]);
+      }
+      else {
+        if (!(flags[m] & PARITY))
+          xorLeaves.push_back(m);
+        flags[m] ^= PARITY;
+      }
     }
-    else {
-      args.push_back(f->GetId());
-      TraverseFormulaTreeAndGenerateCNF(f,conj_tmp);
+
+    // n xor leaves = 0, i.e. the xor of -n and the leaves is true
+    vector<int> disj;
+    disj.push_back(negated ? (int)ids[n] : -(int)ids[n]);
+    for (vector<unsigned int>::iterator it = xorLeaves.begin(); it != xorLeaves.end(); it++) {
+      if (flags[*it] & PARITY) {
+        flags[*it] &= ~PARITY;
+        disj.push_back(ids[*it]);
+        PushCNFTask(CNFTask::VISIT, Formula(*it << 1), CONST, BOTH);
+      }
     }
+    EmitXorClause(disj);
+  }
+
+
+// ----------------------------------------------------------------------------
+
 
+  void FormulaFactory::GatherConjuncts(Formula f, vector<Formula> & args) {
+    vector<Formula> stack(1, f);
+    while (!stack.empty()) {
+      f = stack.back();
+      stack.pop_back();
+      if(f.GetType()==AND) {
+        stack.push_back(f.GetRightF());
+        stack.push_back(f.GetLeftF());
+      }
+      else 
+        args.push_back(f);
+    }
   }
 
 
 // ----------------------------------------------------------------------------
 
 
-  Formula* FormulaFactory::GoThroughNegations(Formula* f, int* level) {
-    if(f->GetType()==NOT) {
-      Formula *n=GoThroughNegations(((FormulaNot*)f)->GetF(), level);
+  Formula FormulaFactory::GoThroughNegations(Formula f, int* level) {
+    *level=0;
+    while(f.GetType()==NOT) {
+      f=f.GetF();
       (*level)++;
-      return n;
-    }
-    else {
-      *level=0;
-      return f;
     }
+    return f;
   }
 
 
 // ----------------------------------------------------------------------------
 
 
-  bool FormulaFactory::IsClause(Formula* f) {
-    if(f->GetType()==OR || f->GetType()==NOT || f->GetType()==VAR || f->GetType()==CONST) 
+  bool FormulaFactory::IsClause(Formula f) {
+    if(f.GetType()==OR || f.GetType()==NOT || f.GetType()==VAR || f.GetType()==CONST) 
       return true;
     else 
       return false;
@@ -246,162 +490,262 @@ FormulaFactory *FormulaFactory::formulaFactory = 0;
 // ----------------------------------------------------------------------------
 
 
-void FormulaFactory::TraverseFormulaTreeAndGenerateCNF(Formula* f,vector<vector <int> > & conj_tmp) {
+  void FormulaFactory::PushCNFTask(CNFTask::Kind kind, Formula f, FORMULA_TYPE type, unsigned char polarity) {
+    CNFTask t;
+    t.kind = kind;
+    t.f = f;
+    t.type = type;
+    t.polarity = polarity;
+    t.start = cnfArgs.size();
+    cnfTasks.push_back(t);
+  }
 
-    // cout << "Traverse " << f->GetId() << " type: " << f->GetType() << " count : " << f->IsDefined() << endl;
-    if (f->IsDefined())
-      return;
 
-    f->SetDefined();
+// ----------------------------------------------------------------------------
+
+
+  // the operands of f are flattened (f itself, if it is not of the type), so
+  // that f is not taken as an operand even if it is SHARED
+  void FormulaFactory::PushOperands(Formula f, FORMULA_TYPE type, unsigned char polarity) {
+    if (f.GetType() == type) {
+      PushCNFTask(CNFTask::FLATTEN, f.GetRightF(), type, polarity);
+      PushCNFTask(CNFTask::FLATTEN, f.GetLeftF(), type, polarity);
+    }
+    else
+      PushCNFTask(CNFTask::FLATTEN, f, type, polarity);
+  }
+
+
+// ----------------------------------------------------------------------------
 
-    vector<int> disj,args;
-    switch (f->GetType()) {
-      case CONST: 
-        break;
 
-      case VAR: 
+// Tseitin transformation driven by the explicit stack cnfTasks (instead of
+// recursion, so that the depth of a formula is not limited by the call stack).
+// VISIT defines a formula by clauses once its subformulas are defined;
+// FLATTEN collects the operands of nested ORs (ANDs) into cnfArgs, a SHARED
+// node being an operand itself, and visits them; DEFINE emits the clauses of
+// a formula and CLAUSE a top-level clause over the operands collected since
+// the task was pushed.
+// f is seen through its type (see Formula.h), so the clauses generated for
+// an OR or an EQUIV define the negation of the stored AND or XOR node.
+// The polarity of a task tells in which directions f is used: if f occurs
+// positively only the clauses with -f are needed (f implies its definition),
+// if it occurs negatively only the clauses with f. The operands of an AND or
+// an OR inherit the polarity of f, the operands of XOR and EQUIV occur in
+// both. Without the polarity-aware encoding all formulas occur in both.
+void FormulaFactory::TraverseFormulaTreeAndGenerateCNF() {
+
+  while (!cnfTasks.empty()) {
+    CNFTask t = cnfTasks.back();
+    cnfTasks.pop_back();
+
+    Formula f = t.f;
+    vector<int> disj;
+    switch (t.kind) {
+    case CNFTask::VISIT :
+      {
+      // cout << "Traverse " << f.GetId() << " type: " << f.GetType() << " count : " << f.IsDefined() << endl;
+      // the flags keep the polarities of the stored node, not of f
+      unsigned int n = f.GetNode();
+      unsigned char polarity = (f.IsNegated() ? FlipPolarity(t.polarity) : t.polarity) & ~flags[n];
+      if (polarity == 0)
         break;
 
-      case NOT :
-        {
-           assert(false);
-           /*
-           tmp = ((FormulaNot*)f)->GetF();
-           disj.push_back(f->GetId());
-           disj.push_back(tmp->GetId());
-           conj_tmp.push_back(disj);
-           disj.clear();
-           
-           disj.push_back(-f->GetId());
-           disj.push_back(-tmp->GetId());
-           conj_tmp.push_back(disj);
-           disj.clear();
-           */
-           break;
-         }
-      
-      case AND :
-    	{
-          TraverseNaryConnectives(f,AND,args,conj_tmp);          
-          disj.push_back(f->GetId());
-          for (unsigned int i=0; i<args.size(); i++)  
-            disj.push_back(-args[i]);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          for (unsigned int i=0; i<args.size(); i++) {
-            disj.push_back(-f->GetId());
-            disj.push_back(args[i]);
-            conj_tmp.push_back(disj);
+      t.first = !(flags[n] & BOTH);
+      flags[n] |= polarity | DEFINED;
+      t.polarity = (f.IsNegated() ? FlipPolarity(polarity) : polarity);
+
+      switch (f.GetType()) {
+        case NOT :
+          assert(false);
+          break;
+
+        case AND :
+        case OR :
+          t.kind = CNFTask::DEFINE;
+          t.type = f.GetType();
+          t.start = cnfArgs.size();
+          cnfTasks.push_back(t);
+          PushOperands(f, f.GetType(), t.polarity);
+          break;
+
+        case XOR :
+        case EQUIV :
+          if (bNativeXor) {
+            flags[n] |= BOTH;
+            DefineXorChain(f);
+            break;
+          }
+          {
+            int level;
+            Formula l = GoThroughNegations(f.GetLeftF(), &level);
+            t.l = (level % 2 ? -l.GetId() : l.GetId());
+            Formula r = GoThroughNegations(f.GetRightF(), &level);
+            t.r = (level % 2 ? -r.GetId() : r.GetId());
+
+            t.kind = CNFTask::DEFINE;
+            t.type = f.GetType();
+            cnfTasks.push_back(t);
+            PushCNFTask(CNFTask::VISIT, r, CONST, BOTH);
+            PushCNFTask(CNFTask::VISIT, l, CONST, BOTH);
+            break;
+          }
+
+        default :
+          break;
+      }
+      break;
+      }
+
+    case CNFTask::FLATTEN :
+      if (f.GetType()==t.type && !(flags[f.GetNode()] & SHARED))
+        PushOperands(f, t.type, t.polarity);
+      else if (f.GetType()==VAR) {
+        f.SetDefined();
+        cnfArgs.push_back(f.GetId());
+      }
+      else if (f.GetType()==NOT) {
+        int level;
+        Formula a = GoThroughNegations(f, &level);
+        cnfArgs.push_back(level % 2 ? -a.GetId() : a.GetId());
+        PushCNFTask(CNFTask::VISIT, a, CONST, level % 2 ? FlipPolarity(t.polarity) : t.polarity);
+      }
+      else {
+        cnfArgs.push_back(f.GetId());
+        PushCNFTask(CNFTask::VISIT, f, CONST, t.polarity);
+      }
+      break;
+
+    case CNFTask::CLAUSE :
+      for (unsigned int i=t.start; i<cnfArgs.size(); i++)  
+        disj.push_back(cnfArgs[i]);
+      EmitClause(disj);
+      cnfArgs.resize(t.start);
+      break;
+
+    case CNFTask::DEFINE :
+      {
+      // the clauses of the full definition are counted as skipped when f is
+      // defined for the first time, the emitted ones are subtracted
+      unsigned long emitted = cnfClauses;
+      switch (t.type) {
+        case AND :
+          if (t.first)
+            cnfSkipped += cnfArgs.size() - t.start + 1;
+
+          if (t.polarity & NEGATIVE) {
+            disj.push_back(f.GetId());
+            for (unsigned int i=t.start; i<cnfArgs.size(); i++)  
+              disj.push_back(-cnfArgs[i]);
+            EmitClause(disj);
             disj.clear();
           }
-          args.clear();
+
+          if (t.polarity & POSITIVE) {
+            for (unsigned int i=t.start; i<cnfArgs.size(); i++) {
+              disj.push_back(-f.GetId());
+              disj.push_back(cnfArgs[i]);
+              EmitClause(disj);
+              disj.clear();
+            }
+          }
+          cnfArgs.resize(t.start);
           break;
-        }
-      
-      case OR :
-        {
-          TraverseNaryConnectives(f,OR,args,conj_tmp);          
-          disj.push_back(-f->GetId());
-          for (unsigned int i=0; i<args.size(); i++) 
-   	        disj.push_back(args[i]);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          for (unsigned int i=0; i<args.size(); i++) {
-            disj.push_back(f->GetId());
-            disj.push_back(-args[i]);
-            conj_tmp.push_back(disj);
+
+        case OR :
+          if (t.first)
+            cnfSkipped += cnfArgs.size() - t.start + 1;
+
+          if (t.polarity & POSITIVE) {
+            disj.push_back(-f.GetId());
+            for (unsigned int i=t.start; i<cnfArgs.size(); i++) 
+              disj.push_back(cnfArgs[i]);
+            EmitClause(disj);
             disj.clear();
           }
-          args.clear();
+
+          if (t.polarity & NEGATIVE) {
+            for (unsigned int i=t.start; i<cnfArgs.size(); i++) {
+              disj.push_back(f.GetId());
+              disj.push_back(-cnfArgs[i]);
+              EmitClause(disj);
+              disj.clear();
+            }
+          }
+          cnfArgs.resize(t.start);
           break;
-	}
-     	      
-      case XOR :
-    	{
-          int lFormulaID, rFormulaID, level;
-          Formula *a;
-          Formula *l = ((FormulaXor*)f)->GetLeftF(); 
-          Formula *r = ((FormulaXor*)f)->GetRightF();
-
-          a = GoThroughNegations(l, &level);
-          lFormulaID = (level % 2 ? -a->GetId() : a->GetId());
-          TraverseFormulaTreeAndGenerateCNF(a,conj_tmp);
-
-          a = GoThroughNegations(r, &level);
-          rFormulaID = (level % 2 ? -a->GetId() : a->GetId());
-          TraverseFormulaTreeAndGenerateCNF(a,conj_tmp);
-
-          disj.push_back(-f->GetId());
-          disj.push_back(lFormulaID);
-          disj.push_back(rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          disj.push_back(-f->GetId());
-          disj.push_back(-lFormulaID);
-          disj.push_back(-rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          disj.push_back(f->GetId());
-          disj.push_back(-lFormulaID);
-          disj.push_back(rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          disj.push_back(f->GetId());
-          disj.push_back(lFormulaID);
-          disj.push_back(-rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
 
+        case XOR :
+          if (t.first)
+            cnfSkipped += 4;
+
+          if (t.polarity & POSITIVE) {
+            disj.push_back(-f.GetId());
+            disj.push_back(t.l);
+            disj.push_back(t.r);
+            EmitClause(disj);
+            disj.clear();
+
+            disj.push_back(-f.GetId());
+            disj.push_back(-t.l);
+            disj.push_back(-t.r);
+            EmitClause(disj);
+            disj.clear();
+          }
+
+          if (t.polarity & NEGATIVE) {
+            disj.push_back(f.GetId());
+            disj.push_back(-t.l);
+            disj.push_back(t.r);
+            EmitClause(disj);
+            disj.clear();
+
+            disj.push_back(f.GetId());
+            disj.push_back(t.l);
+            disj.push_back(-t.r);
+            EmitClause(disj);
+            disj.clear();
+          }
           break;
-    	}
 
-      case EQUIV :
-        {
-          int lFormulaID, rFormulaID, level;
-          Formula *a;
-          Formula *l = ((FormulaXor*)f)->GetLeftF(); 
-          Formula *r = ((FormulaXor*)f)->GetRightF();
-
-          a = GoThroughNegations(l, &level);
-          lFormulaID = (level % 2 ? -a->GetId() : a->GetId());
-          TraverseFormulaTreeAndGenerateCNF(a,conj_tmp);
-
-          a = GoThroughNegations(r, &level);
-          rFormulaID = (level % 2 ? -a->GetId() : a->GetId());
-          TraverseFormulaTreeAndGenerateCNF(a,conj_tmp);
-
-          disj.push_back(-f->GetId());
-          disj.push_back(-lFormulaID);
-          disj.push_back(rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          disj.push_back(-f->GetId());
-          disj.push_back(lFormulaID);
-          disj.push_back(-rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          disj.push_back(f->GetId());
-          disj.push_back(lFormulaID);
-          disj.push_back(rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
-
-          disj.push_back(f->GetId());
-          disj.push_back(-lFormulaID);
-          disj.push_back(-rFormulaID);
-          conj_tmp.push_back(disj);
-          disj.clear();
+        case EQUIV :
+          if (t.first)
+            cnfSkipped += 4;
+
+          if (t.polarity & POSITIVE) {
+            disj.push_back(-f.GetId());
+            disj.push_back(-t.l);
+            disj.push_back(t.r);
+            EmitClause(disj);
+            disj.clear();
 
+            disj.push_back(-f.GetId());
+            disj.push_back(t.l);
+            disj.push_back(-t.r);
+            EmitClause(disj);
+            disj.clear();
+          }
+
+          if (t.polarity & NEGATIVE) {
+            disj.push_back(f.GetId());
+            disj.push_back(t.l);
+            disj.push_back(t.r);
+            EmitClause(disj);
+            disj.clear();
+
+            disj.push_back(f.GetId());
+            disj.push_back(-t.l);
+            disj.push_back(-t.r);
+            EmitClause(disj);
+            disj.clear();
+          }
           break;
-        }
-  
-     default: break;
-   }
+
+        default: break;
+      }
+      cnfSkipped -= cnfClauses - emitted;
+      break;
+      }
+    }
+  }
 }
@@ -3,12 +3,12 @@ URSA -- Copyright (c) 2010, Predrag Janicic
 
 This file is part of URSA.
 Authors: Milan Sesum and Predrag Janicic
- 
+
 URSA is free software; you can redistribute it and/or modify
 it under the terms of the GNU General Public License as published by
 the Free Software Foundation; either version 2 of the License, or
 (at your option) any later version.
- 
+
 URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
 MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
 GNU General Public License for more details.
@@ -20,8 +20,9 @@ GNU General Public License for more details.
 #include <assert.h>
 #include <vector>
 #include <set>
-#include <unordered_set>
 #include "FormulaVector.h"
+#include "FormulaTable.h"
+#include "ClauseSink.h"
 
 using namespace std;
 
@@ -30,30 +31,67 @@ using namespace std;
 ////	Class FormulaFactory
 ////////////////////////////////////////////////////////////////////////////////
 
+// The factory owns the node store: node n is described by the n-th element
+// of each of the arrays below. Stored node types are CONST, VAR, AND and XOR;
+// the operands of AND and XOR are literals (see Formula.h), the ordinal of
+// a VAR is kept in place of its left operand. Freed nodes are turned into
+// CONST nodes and reused through the list of free nodes.
+
 class FormulaFactory {
 
 private:
 
-  FormulaFactory() {}
+  FormulaFactory();
 
-  class equal_to_Formula {
-    public:
-      bool operator() (const Formula* f1, const Formula* f2) const {
-        return (*f1) == (*f2);
-      }
-  };
+  // DEFINED: the node is a variable of the CNF; POSITIVE, NEGATIVE: the
+  // clauses for the node occurring positively (negatively) were generated
+  // in the current traversal (also used for polarities of CNF tasks);
+  // PARITY: the node occurs an odd number of times in the current xor chain;
+  // SHARED: the node gets a variable of its own even as an operand of a node
+  // of the same type, instead of its operands being collected into that node
+  enum { DEFINED = 1, POSITIVE = 2, NEGATIVE = 4, BOTH = 6, PARITY = 8, SHARED = 16 };
 
-  class hash_Formula {
-    public:
-      size_t operator() (const Formula* f) const {
-        return f->hashCode();
-      }
-  };
+  static unsigned char FlipPolarity(unsigned char p) {
+    return ((p & POSITIVE) ? NEGATIVE : 0) | ((p & NEGATIVE) ? POSITIVE : 0);
+  }
 
-  typedef unordered_set<Formula*, hash_Formula, equal_to_Formula> FormulaPointerSet;
-  FormulaPointerSet existingFormulas;
+  FormulaTable existingFormulas;
   static FormulaFactory *formulaFactory;
 
+  vector<unsigned char> types;
+  vector<unsigned char> flags;
+  vector<unsigned int> lefts, rights;
+  vector<unsigned int> refCounts;
+  vector<unsigned int> ids;
+  vector<unsigned int> freeNodes;
+  vector<pair<unsigned int, unsigned int> > removeStack;
+
+  struct CNFTask {
+    enum Kind { VISIT, FLATTEN, DEFINE, CLAUSE } kind;
+    Formula f;
+    FORMULA_TYPE type;
+    unsigned int start;  // the operands of f start at cnfArgs[start]
+    int l, r;            // ids of the operands of XOR and EQUIV
+    unsigned char polarity;
+    bool first;          // f is defined for the first time
+  };
+  vector<CNFTask> cnfTasks;
+  vector<int> cnfArgs;
+  bool bPolarityAware;
+  bool bNativeXor;
+  // the number of references to a node from XOR nodes, plus two for each
+  // reference from other nodes (or from the constraint)
+  vector<unsigned int> cnfUses;
+  vector<unsigned int> xorStack, xorLeaves;
+  ClauseSink *cnfSink;
+  unsigned int *cnfMap;
+  unsigned long cnfClauses, cnfSkipped;
+  // reported with -v, since the last Clear: the calls of IncNodeRefCount
+  // and DecNodeRefCount, the formula vectors allocated on the heap and the
+  // reallocations of the node arrays (counted only if bStatistics is set)
+  bool bStatistics;
+  unsigned long refCountUpdates, vectorAllocations, nodeAllocations;
+
 
 public:
 
@@ -63,32 +101,65 @@ public:
     return FormulaFactory::formulaFactory;
   }
 
-  ~FormulaFactory() {
-     Clear();
-  }
-
-  void Clear() {
-     existingFormulas.clear();
-     formulaFactory = 0;
-  }
-
-  FormulaPointerSet::iterator begin(void) { return existingFormulas.begin(); }
-  FormulaPointerSet::iterator end(void) { return existingFormulas.end(); }
+  // all formulas are released, so no formula may be referenced after this
+  void Clear();
 
   void print(void);
-  Formula* Get(Formula *f);
-  void Remove(Formula *f);
+  void SetStatistics(bool b) { bStatistics = b; }
+  void CountVectorAllocation() { if (bStatistics) ++vectorAllocations; }
+  void PrintStatistics(void);
+
+  // hash-consing: an existing equal formula is returned if there is one,
+  // a new node is stored only otherwise
+  Formula GetConst(bool value);
+  Formula GetVar(unsigned int ordinal);
+  Formula GetBinary(FORMULA_TYPE type, Formula f1, Formula f2);
+  void Remove(Formula f);
+
+  FORMULA_TYPE GetNodeType(unsigned int n) const { return (FORMULA_TYPE)types[n]; }
+  unsigned int GetNodeLeft(unsigned int n) const { return lefts[n]; }
+  unsigned int GetNodeRight(unsigned int n) const { return rights[n]; }
+  unsigned int GetNodeId(unsigned int n) const { return ids[n]; }
+
+  void IncNodeRefCount(unsigned int n) { ++refCounts[n]; if (bStatistics) ++refCountUpdates; }
+  void DecNodeRefCount(unsigned int n) { --refCounts[n]; if (bStatistics) ++refCountUpdates; }
+  unsigned int GetNodeRefCount(unsigned int n) const { return refCounts[n]; }
+
+  bool IsNodeDefined(unsigned int n) const { return flags[n] & DEFINED; }
+  void SetNodeDefined(unsigned int n) { flags[n] |= DEFINED; }
+  void SetNodeShared(unsigned int n) { flags[n] |= SHARED; }
+
   void SetIds(int *varCount);
-  bool GenerateCNF(FormulaVector constraint, vector<vector<int> >& conj, unsigned int* pMappedVarId, int* varCount);
+  // Plaisted-Greenbaum encoding: only the clauses needed for the polarity
+  // in which a formula occurs are generated
+  void SetPolarityAware(bool b) { bPolarityAware = b; }
+  // maximal chains of XORs are given to the sink as single xor clauses
+  void SetNativeXor(bool b) { bNativeXor = b; }
+  // the number of clauses of the full encoding left out by CountCNF
+  unsigned long GetSkippedClauses() const { return cnfSkipped; }
+  // the CNF of the constraint is not stored: CountCNF determines its
+  // variables (and their mapping to SAT variables) and counts its clauses,
+  // GenerateCNF then gives the clauses to the sink one by one
+  bool CountCNF(FormulaVector constraint, unsigned int* pMappedVarId, int* varCount, unsigned long* clauseCount);
+  void GenerateCNF(FormulaVector constraint, unsigned int* pMappedVarId, ClauseSink& sink);
 
 private:
-  bool IsClause(Formula* f);
-  void GatherConjuncts(Formula* f, vector<Formula*> & args);
-
-  Formula* GoThroughNegations(Formula* f, int* level);
-
-  void TraverseNaryConnectives(Formula* f, FORMULA_TYPE type, vector<int> & args,vector<vector <int> > & conj_tmp);
-  void TraverseFormulaTreeAndGenerateCNF(Formula* f,vector<vector <int> > & conj_tmp);
+  static unsigned int Hash(unsigned int type, unsigned int left, unsigned int right);
+  Formula MakeNode(FORMULA_TYPE type, unsigned int left, unsigned int right);
+
+  bool IsClause(Formula f);
+  void GatherConjuncts(Formula f, vector<Formula> & args);
+
+  Formula GoThroughNegations(Formula f, int* level);
+
+  void PushCNFTask(CNFTask::Kind kind, Formula f, FORMULA_TYPE type, unsigned char polarity);
+  void PushOperands(Formula f, FORMULA_TYPE type, unsigned char polarity);
+  void TraverseConjuncts(Formula root);
+  void EmitClause(vector<int> & disj);
+  void EmitXorClause(vector<int> & disj);
+  void CountUses(Formula root);
+  void DefineXorChain(Formula f);
+  void TraverseFormulaTreeAndGenerateCNF();
 };
 
 #endif
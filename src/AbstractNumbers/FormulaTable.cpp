@@ -0,0 +1,220 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA.
+Authors: Milan Sesum and Predrag Janicic
+
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#include <assert.h>
+#include "FormulaTable.h"
+
+#define INITIAL_CAPACITY 1024
+#define MIGRATION_STEP 16
+// marks a slot of the old table whose entry was moved or erased
+#define MOVED 0xFFFFFFFF
+
+
+////////////////////////////////////////////////////////////////////////////////
+////	Class FormulaTable
+////////////////////////////////////////////////////////////////////////////////
+
+
+FormulaTable::FormulaTable() : table(0), oldTable(0) {
+  Clear();
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaTable::~FormulaTable() {
+  delete [] table;
+  delete [] oldTable;
+}
+
+
+// -------------------------------------------------------------------
+
+
+void FormulaTable::Clear() {
+  delete [] table;
+  delete [] oldTable;
+
+  capacity = INITIAL_CAPACITY;
+  table = new Slot [capacity]();
+  count = 0;
+
+  oldTable = 0;
+  oldCapacity = oldCount = moved = 0;
+
+  lookups = probes = collisions = 0;
+  longestProbe = 0;
+}
+
+
+// -------------------------------------------------------------------
+
+
+unsigned int FormulaTable::Find(unsigned int hash, unsigned int type, unsigned int left, unsigned int right) {
+  unsigned int length = 1, node = 0;
+  size_t mask = capacity - 1, i;
+
+  for (i = hash & mask; table[i].node; i = (i + 1) & mask, length++) {
+    if (Matches(table[i], hash, type, left, right)) {
+      node = table[i].node;
+      break;
+    }
+    collisions++;
+  }
+
+  if (!node && oldTable) {
+    mask = oldCapacity - 1;
+    for (i = hash & mask; oldTable[i].node; i = (i + 1) & mask, length++) {
+      if (oldTable[i].node != MOVED && Matches(oldTable[i], hash, type, left, right)) {
+        node = oldTable[i].node;
+        break;
+      }
+      collisions++;
+    }
+  }
+
+  lookups++;
+  probes += length;
+  if (length > longestProbe)
+    longestProbe = length;
+
+  return node;
+}
+
+
+// -------------------------------------------------------------------
+
+
+void FormulaTable::Insert(unsigned int hash, unsigned int type, unsigned int left, unsigned int right, unsigned int node) {
+  assert(node != 0 && node != MOVED);
+
+  if (oldTable)
+    Migrate(MIGRATION_STEP);
+  if (2 * (count + oldCount + 1) > capacity)
+    Grow();
+
+  Slot s = { hash, type, left, right, node };
+  Place(s);
+}
+
+
+// -------------------------------------------------------------------
+
+
+void FormulaTable::Erase(unsigned int hash, unsigned int type, unsigned int left, unsigned int right) {
+  size_t mask = capacity - 1, i, j, k;
+
+  for (i = hash & mask; table[i].node; i = (i + 1) & mask)
+    if (Matches(table[i], hash, type, left, right))
+      break;
+
+  if (table[i].node) {
+    // backward shift: entries after the erased one that would not be found
+    // from their home slot any more are moved into the gap
+    for (j = i; ; ) {
+      j = (j + 1) & mask;
+      if (!table[j].node)
+        break;
+      k = table[j].hash & mask;
+      if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+        table[i] = table[j];
+        i = j;
+      }
+    }
+    table[i].node = 0;
+    count--;
+    return;
+  }
+
+  if (oldTable) {
+    mask = oldCapacity - 1;
+    for (i = hash & mask; oldTable[i].node; i = (i + 1) & mask)
+      if (oldTable[i].node != MOVED && Matches(oldTable[i], hash, type, left, right)) {
+        oldTable[i].node = MOVED;
+        oldCount--;
+        return;
+      }
+  }
+}
+
+
+// -------------------------------------------------------------------
+
+
+double FormulaTable::GetLoadFactor() const {
+  return (double)(count + oldCount) / capacity;
+}
+
+
+// -------------------------------------------------------------------
+
+
+double FormulaTable::GetAverageProbeLength() const {
+  return lookups ? (double)probes / lookups : 0;
+}
+
+
+// -------------------------------------------------------------------
+
+
+void FormulaTable::Place(const Slot& s) {
+  size_t mask = capacity - 1, i;
+  for (i = s.hash & mask; table[i].node; i = (i + 1) & mask)
+    ;
+  table[i] = s;
+  count++;
+}
+
+
+// -------------------------------------------------------------------
+
+
+void FormulaTable::Grow() {
+  // a resize in progress is completed first
+  if (oldTable)
+    Migrate(oldCapacity);
+
+  oldTable = table;
+  oldCapacity = capacity;
+  oldCount = count;
+  moved = 0;
+
+  capacity *= 2;
+  table = new Slot [capacity]();
+  count = 0;
+}
+
+
+// -------------------------------------------------------------------
+
+
+void FormulaTable::Migrate(size_t slots) {
+  for (; slots && moved < oldCapacity; slots--, moved++) {
+    Slot &s = oldTable[moved];
+    if (s.node && s.node != MOVED) {
+      Place(s);
+      s.node = MOVED;
+      oldCount--;
+    }
+  }
+
+  if (moved == oldCapacity) {
+    delete [] oldTable;
+    oldTable = 0;
+    oldCapacity = oldCount = moved = 0;
+  }
+}
@@ -0,0 +1,82 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA.
+Authors: Milan Sesum and Predrag Janicic
+
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#ifndef __FORMULA_TABLE_H
+#define __FORMULA_TABLE_H
+
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////////////////////////
+////	Class FormulaTable
+////////////////////////////////////////////////////////////////////////////////
+
+// Unique table of the FormulaFactory: maps a node key (type and two operands,
+// ordered by the factory) to the node.
+// Open addressing with linear probing; the hash and the key are kept in the
+// slot, so a probe never leaves the table. When the table gets half full a
+// table of double size is allocated and the entries are moved to it a few
+// slots per operation; until then lookups also visit the old table.
+
+class FormulaTable {
+
+public:
+
+  FormulaTable();
+  ~FormulaTable();
+
+  // the node stored under the key, 0 if there is none
+  unsigned int Find(unsigned int hash, unsigned int type, unsigned int left, unsigned int right);
+  // the key must not be in the table
+  void Insert(unsigned int hash, unsigned int type, unsigned int left, unsigned int right, unsigned int node);
+  void Erase(unsigned int hash, unsigned int type, unsigned int left, unsigned int right);
+  void Clear();
+
+  size_t GetCount() const { return count + oldCount; }
+  double GetLoadFactor() const;
+  double GetAverageProbeLength() const;
+  unsigned int GetLongestProbe() const { return longestProbe; }
+  // the number of occupied slots probed by Find without a match
+  unsigned long GetCollisions() const { return collisions; }
+
+private:
+
+  struct Slot {
+    unsigned int hash, type, left, right;
+    unsigned int node;   // 0 for an empty slot
+  };
+
+  bool Matches(const Slot& s, unsigned int hash, unsigned int type, unsigned int left, unsigned int right) const {
+    return s.hash == hash && s.type == type && s.left == left && s.right == right;
+  }
+
+  void Place(const Slot& s);
+  void Grow();
+  void Migrate(size_t slots);
+
+  Slot *table;
+  size_t capacity, count;
+
+  // the table being emptied during a resize, moved is the number of its
+  // slots already visited
+  Slot *oldTable;
+  size_t oldCapacity, oldCount, moved;
+
+  unsigned long lookups, probes, collisions;
+  unsigned int longestProbe;
+};
+
+#endif
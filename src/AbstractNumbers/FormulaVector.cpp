@@ -15,6 +15,9 @@ GNU General Public License for more details.
 **************************************************************************************/
 
 #include <assert.h>
+#include <algorithm>
+#include <deque>
+#include <utility>
 #include "FormulaVector.h"
 #include "FormulaFactory.h"
 
@@ -24,14 +27,26 @@ GNU General Public License for more details.
 ////////////////////////////////////////////////////////////////////////////////
 
 
+void FormulaVector::Allocate(unsigned int n) {
+  size = n;
+  if (n <= INLINE_BITS)
+    bitArray = inlineBits;
+  else {
+    bitArray = new Formula [n];
+    FormulaFactory::Instance()->CountVectorAllocation();
+  }
+}
+
+
+// -------------------------------------------------------------------
+
+
 FormulaVector::FormulaVector() {
-  Formula *f = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  size = iAbstractNumberLength;
-  bitArray = new Formula* [size];
+  Formula f = FormulaFactory::Instance()->GetConst(false);
+  Allocate(iAbstractNumberLength);
   for (unsigned int i = 0; i < size; i++) {
     bitArray[i] = f;
-    f->IncRefCount();
+    f.IncRefCount();
   }
 }
 
@@ -40,11 +55,10 @@ FormulaVector::FormulaVector() {
 
 
 FormulaVector::FormulaVector(const FormulaVector &fv) {
-  size = fv.getSize();
-  bitArray = new Formula* [size];
+  Allocate(fv.getSize());
   for (unsigned int i = 0; i < size; i++) {
     bitArray[i] = fv.bitArray[i];
-    fv.bitArray[i]->IncRefCount();
+    fv.bitArray[i].IncRefCount();
   }
 }
 
@@ -52,15 +66,29 @@ FormulaVector::FormulaVector(const FormulaVector &fv) {
 // -------------------------------------------------------------------
 
 
-FormulaVector::FormulaVector(unsigned int n) {
-  Formula *f = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  size = n;
+FormulaVector::FormulaVector(FormulaVector &&fv) {
+  if (fv.bitArray != fv.inlineBits) {
+    size = fv.size;
+    bitArray = fv.bitArray;
+  }
+  else {
+    Allocate(fv.size);
+    for (unsigned int i = 0; i < size; i++)
+      bitArray[i] = fv.bitArray[i];
+  }
+  fv.Allocate(0);
+}
+
+
+// -------------------------------------------------------------------
+
 
-  bitArray = new Formula* [size];
+FormulaVector::FormulaVector(unsigned int n) {
+  Formula f = FormulaFactory::Instance()->GetConst(false);
+  Allocate(n);
   for (unsigned int i = 0; i < size; i++) {
     bitArray[i] = f;
-    f->IncRefCount();
+    f.IncRefCount();
   }
 }
 
@@ -69,22 +97,11 @@ FormulaVector::FormulaVector(unsigned int n) {
 
 
 FormulaVector::FormulaVector(const GroundNumber &n) {
-  unsigned int i;
-  Formula *NT = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  Formula *T = FormulaFactory::Instance()->Get(new FormulaT());
-  Formula::NEW++;
-
-  for (i = 0; i < size; i++) {
-    if (n.Bit(i))
-      setFormulaAt(size - 1 - i, T);
-    else
-      setFormulaAt(size - 1 - i, NT);
- cout << i << endl;  
-}
-
-  FormulaFactory::Instance()->Remove(T);
-  FormulaFactory::Instance()->Remove(NT);
+  Allocate(iAbstractNumberLength);
+  for (unsigned int i = 0; i < size; i++) {
+    bitArray[size - 1 - i] = FormulaFactory::Instance()->GetConst(n.Bit(i));
+    bitArray[size - 1 - i].IncRefCount();
+  }
 }
 
 
@@ -94,11 +111,12 @@ FormulaVector::FormulaVector(const GroundNumber &n) {
 
 FormulaVector::~FormulaVector() {
   for (unsigned int i = 0; i < size; i++) {
-    bitArray[i]->DecRefCount();
+    bitArray[i].DecRefCount();
     FormulaFactory::Instance()->Remove(bitArray[i]);
   }
 
-  delete [] bitArray;
+  if (bitArray != inlineBits)
+    delete [] bitArray;
 }
 
 
@@ -106,11 +124,10 @@ FormulaVector::~FormulaVector() {
 
 
 FormulaVector& FormulaVector::operator = (unsigned long n) {
-  unsigned int i, j;
-  Formula *NT = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  Formula *T = FormulaFactory::Instance()->Get(new FormulaT());
-  Formula::NEW++;
+  unsigned int i;
+  unsigned long j;
+  Formula NT = FormulaFactory::Instance()->GetConst(false);
+  Formula T = FormulaFactory::Instance()->GetConst(true);
 
   for (i = 0, j = n; i < size; i++, j /= 2)
     if (j % 2)
@@ -130,10 +147,8 @@ FormulaVector& FormulaVector::operator = (unsigned long n) {
 
 FormulaVector& FormulaVector::FormulaVector::operator = (const GroundNumber &n) {
   unsigned int i;
-  Formula *NT = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;	
-  Formula *T = FormulaFactory::Instance()->Get(new FormulaT());
-  Formula::NEW++;
+  Formula NT = FormulaFactory::Instance()->GetConst(false);
+  Formula T = FormulaFactory::Instance()->GetConst(true);
 
   for (i = 0; i < size; i++) {
     if (n.Bit(i))
@@ -153,7 +168,8 @@ FormulaVector& FormulaVector::FormulaVector::operator = (const GroundNumber &n)
 
 
 FormulaVector& FormulaVector::operator = (const FormulaVector &fv) {
-  assert(size == fv.getSize());
+  if (size != fv.getSize())
+    return (*this = FormulaVector(fv));
 
   for (unsigned int i = 0; i < fv.getSize(); i++)
     setFormulaAt(i, fv.bitArray[i]);
@@ -165,12 +181,47 @@ FormulaVector& FormulaVector::operator = (const FormulaVector &fv) {
 // -------------------------------------------------------------------
 
 
-void FormulaVector::setFormulaAt(unsigned int i, Formula *f) {
+// the old formulas are released by fv, in the same order as by the copy
+FormulaVector& FormulaVector::operator = (FormulaVector &&fv) {
+  Swap(fv);
+  return *this;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the formulas of both vectors are exchanged, with no reference counting
+void FormulaVector::Swap(FormulaVector &fv) {
+  if (bitArray != inlineBits && fv.bitArray != fv.inlineBits)
+    swap(bitArray, fv.bitArray);
+  else if (bitArray != inlineBits) {
+    for (unsigned int i = 0; i < fv.size; i++)
+      inlineBits[i] = fv.inlineBits[i];
+    fv.bitArray = bitArray;
+    bitArray = inlineBits;
+  }
+  else if (fv.bitArray != fv.inlineBits) {
+    for (unsigned int i = 0; i < size; i++)
+      fv.inlineBits[i] = inlineBits[i];
+    bitArray = fv.bitArray;
+    fv.bitArray = fv.inlineBits;
+  }
+  else
+    swap_ranges(inlineBits, inlineBits + max(size, fv.size), fv.inlineBits);
+  swap(size, fv.size);
+}
+
+
+// -------------------------------------------------------------------
+
 
-  Formula *tmp = bitArray[i];
+void FormulaVector::setFormulaAt(unsigned int i, Formula f) {
+
+  Formula tmp = bitArray[i];
   bitArray[i] = f;
-  f->IncRefCount();
-  tmp->DecRefCount();
+  f.IncRefCount();
+  tmp.DecRefCount();
   FormulaFactory::Instance()->Remove(tmp);
 }
 
@@ -178,7 +229,7 @@ void FormulaVector::setFormulaAt(unsigned int i, Formula *f) {
 // -------------------------------------------------------------------
 
 
-Formula* FormulaVector::getFormulaFrom(unsigned int i) const {
+Formula FormulaVector::getFormulaFrom(unsigned int i) const {
   return bitArray[i];
 }
 
@@ -186,7 +237,7 @@ Formula* FormulaVector::getFormulaFrom(unsigned int i) const {
 // -------------------------------------------------------------------
 
 
-Formula* FormulaVector::operator [] (unsigned int i) const {
+Formula FormulaVector::operator [] (unsigned int i) const {
   return bitArray[i];
 }
 
@@ -196,9 +247,8 @@ Formula* FormulaVector::operator [] (unsigned int i) const {
 
 void FormulaVector::init(unsigned int n) {
   for (unsigned int i = 0; i < size; i++) { 
-    Formula *f = FormulaFactory::Instance()->Get(new FormulaVar(n + i + 1));
+    Formula f = FormulaFactory::Instance()->GetVar(n + i + 1);
     setFormulaAt(i, f);
-    Formula::NEW++;
   }
 }
 
@@ -206,11 +256,27 @@ void FormulaVector::init(unsigned int n) {
 
 void FormulaVector::initDefined(unsigned int n) {
   for (unsigned int i = 0; i < size; i++) { 
-    Formula *f = FormulaFactory::Instance()->Get(new FormulaVar(n + i + 1));
+    Formula f = FormulaFactory::Instance()->GetVar(n + i + 1);
+    setFormulaAt(i, f);
+    f.SetDefined();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// only the lowest width bits are variables (n+1 being the most significant
+// of them); the bits above are zero or, for signed numbers, copies of the
+// highest variable
+void FormulaVector::initDefined(unsigned int n, unsigned int width, bool bSigned) {
+  assert(width >= 1 && width <= size);
+  for (unsigned int i = size - width; i < size; i++) { 
+    Formula f = FormulaFactory::Instance()->GetVar(n + i - (size - width) + 1);
     setFormulaAt(i, f);
-    f->SetDefined();
-    Formula::NEW++;
+    f.SetDefined();
   }
+  Formula ext = bSigned ? bitArray[size - width] : FormulaFactory::Instance()->GetConst(false);
+  for (unsigned int i = 0; i < size - width; i++)
+    setFormulaAt(i, ext);
 }
 
 
@@ -221,7 +287,7 @@ FormulaVector FormulaVector::operator ~ () const {
 
   FormulaVector notFormulaVector(size);
 
-  Formula *tmp;
+  Formula tmp;
   for (unsigned int i = 0; i < size; i++) {
     tmp = Formula::makeNot(bitArray[i]);
     notFormulaVector.setFormulaAt(i, tmp);
@@ -243,8 +309,7 @@ FormulaVector FormulaVector::operator << (unsigned int k) const {
   for (unsigned int i = k; i < size; i++)
     shlFormulaVector.setFormulaAt(i - k, bitArray[i]);
 
-  Formula *f = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
+  Formula f = FormulaFactory::Instance()->GetConst(false);
 
   if (k>size)
     k=size;
@@ -268,8 +333,7 @@ FormulaVector FormulaVector::operator >> (unsigned int k) const {
   if (k>size)
     k=size;
 
-  Formula *f = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
+  Formula f = FormulaFactory::Instance()->GetConst(false);
   for (unsigned int i = 0; i < k; i++)
     shrFormulaVector.setFormulaAt(i, f);
 
@@ -283,12 +347,70 @@ FormulaVector FormulaVector::operator >> (unsigned int k) const {
 // -------------------------------------------------------------------
 
 
+FormulaVector FormulaVector::operator << (const FormulaVector &s) const {
+  return barrelShift(s, true);
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::operator >> (const FormulaVector &s) const {
+  return barrelShift(s, false);
+}
+
+
+// -------------------------------------------------------------------
+
+
+// barrel shifter: the stage for the bit j of the amount shifts by 2^j if
+// the bit is set; a stage with a constant control bit needs no
+// multiplexers, and the bits of the amount of weight 2^j >= size only
+// clear the result
+FormulaVector FormulaVector::barrelShift(const FormulaVector &s, bool left) const {
+  FormulaVector res(*this);
+  FormulaVector1 c;
+  Formula over = FormulaFactory::Instance()->GetConst(false);
+  unsigned int n = s.getSize(), i, j;
+
+  for (j = 0; j < n; j++) {
+    Formula f = s.bitArray[n - 1 - j];
+    if (f.GetType() == CONST && !f.GetValue())
+      continue;
+
+    if (j < 31 && (1u << j) < size) {
+      FormulaVector shifted = (left ? res << (1u << j) : res >> (1u << j));
+      if (f.GetType() == CONST)
+        res = shifted;
+      else {
+        c = f;
+        res = c.ite(shifted, res);
+      }
+    }
+    else
+      over = Formula::makeOr(over, f);
+  }
+
+  over.IncRefCount();
+  Formula keep = Formula::makeNot(over);
+  for (i = 0; i < size; i++)
+    res.setFormulaAt(i, Formula::makeAnd(res.bitArray[i], keep));
+  over.DecRefCount();
+  FormulaFactory::Instance()->Remove(over);
+
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
 FormulaVector FormulaVector::operator | (const FormulaVector &fv) const {
   assert(size == fv.getSize());
 
   FormulaVector res(size);
 
-  Formula *tmp;
+  Formula tmp;
   for (unsigned int i = 0; i < size; i++) {
     tmp = Formula::makeOr(bitArray[i], fv.bitArray[i]);
     res.setFormulaAt(i, tmp);
@@ -306,7 +428,7 @@ FormulaVector FormulaVector::operator ^ (const FormulaVector &fv) const {
 
   FormulaVector res(size);
 
-  Formula *f;
+  Formula f;
   for (unsigned int i = 0; i < size; i++) {
     f = Formula::makeXor(bitArray[i], fv.bitArray[i]);
     res.setFormulaAt(i, f);
@@ -323,7 +445,7 @@ FormulaVector FormulaVector::operator & (const FormulaVector &fv) const {
   assert(size == fv.getSize());
   FormulaVector res(size);
 
-  Formula *f;
+  Formula f;
   for (unsigned int i = 0; i < size; i++) {
     f = Formula::makeAnd(bitArray[i], fv.bitArray[i]);
     res.setFormulaAt(i, f);
@@ -345,35 +467,352 @@ FormulaVector FormulaVector::operator & (const unsigned long c) const {
 // -------------------------------------------------------------------
 
 
+FormulaVector FormulaVector::operator & (const GroundNumber &c) const {
+  FormulaVector res(size);
+  for (unsigned int w = 0; w < size; w++)
+    if (c.Bit(w))
+      res.setFormulaAt(size - 1 - w, bitArray[size - 1 - w]);
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::operator | (const GroundNumber &c) const {
+  FormulaVector res(*this);
+  for (unsigned int w = 0; w < size; w++)
+    if (c.Bit(w))
+      res.setFormulaAt(size - 1 - w, FormulaFactory::Instance()->GetConst(true));
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::operator ^ (const GroundNumber &c) const {
+  FormulaVector res(*this);
+  for (unsigned int w = 0; w < size; w++)
+    if (c.Bit(w))
+      res.setFormulaAt(size - 1 - w, Formula::makeNot(bitArray[size - 1 - w]));
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the product is computed modulo 2^size, so only the partial products of
+// weight less than size are generated; a constant operand is recoded
 FormulaVector FormulaVector::operator * (const FormulaVector &fv) {
   assert(size == fv.getSize());
-  FormulaVector res(2 * size);
 
-  for (unsigned int i = 0; i < size; i++) {
-    Formula *f = Formula::makeAnd(bitArray[i], fv.bitArray[fv.getSize() - 1]);
-    res.setFormulaAt(i + size, f);
+  const FormulaVector *a = this, *c = &fv;
+  if (!fv.isConst()) {
+    if (!isConst())
+      return mulTree(fv);
+    a = &fv;
+    c = this;
   }
 
-  FormulaVector tmp_p(2 * size);
-  for (int j = size - 1; j >= 0; j--)
-    tmp_p.setFormulaAt(size + j, bitArray[j]);
+  vector<int> bits(size);
+  for (unsigned int w = 0; w < size; w++)
+    bits[w] = c->bitArray[size - 1 - w].GetValue();
+  return a->mulConst(bits);
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::operator * (const GroundNumber &c) const {
+  vector<int> bits(size);
+  for (unsigned int w = 0; w < size; w++)
+    bits[w] = c.Bit(w);
+  return mulConst(bits);
+}
+
+
+// -------------------------------------------------------------------
+
+
+bool FormulaVector::isConst(void) const {
+  for (unsigned int i = 0; i < size; i++)
+    if (bitArray[i].GetType() != CONST)
+      return false;
+  return true;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the number of bits added by the adders for the given digits of a
+// constant, when the positive digits are added first (the first of them
+// to a zero, so it costs nothing)
+static unsigned int MulConstCost(const vector<int> &digits) {
+  unsigned int cost = 0, size = digits.size();
+  bool first = true;
+  for (unsigned int w = 0; w < size; w++)
+    if (digits[w] > 0 && first)
+      first = false;
+    else if (digits[w])
+      cost += size - w;
+  return cost;
+}
+
+
+// shifted copies of this are added for the ones of the constant (its bits
+// are given by weight), or added and subtracted for the nonzero digits of
+// its non-adjacent form (a run of ones 2^j + ... + 2^i is taken as
+// 2^(j+1) - 2^i), whichever is cheaper
+FormulaVector FormulaVector::mulConst(const vector<int> &bits) const {
+  vector<int> digits(size, 0);
+  unsigned int carry = 0, w;
 
-  for (int j = fv.getSize() - 2; j >= 0; j--) {
+  for (w = 0; w < size; w++) {
+    unsigned int bit = bits[w] + carry;
+    bool next = (w + 1 < size && bits[w + 1]);
 
-    FormulaVector tmp = tmp_p << (fv.getSize() - 1 - j);
-    Formula *f;
-    for (unsigned int i = 0; i < tmp.getSize(); i++) {
-      f = Formula::makeAnd(tmp.bitArray[i], fv.bitArray[j]);
-      tmp.setFormulaAt(i, f);
+    if (bit == 1) {
+      digits[w] = (next ? -1 : 1);
+      carry = next;
     }
-    res += tmp;
+    else
+      carry = bit / 2;
   }
 
-  FormulaVector result;
-  for (unsigned int j = 0; j < size; j++)
-    result.setFormulaAt(j, res.bitArray[size+j]);
+  if (MulConstCost(bits) <= MulConstCost(digits))
+    digits = bits;
 
-  return result;
+  FormulaVector res(size);
+  for (w = 0; w < size; w++)
+    if (digits[w] > 0)
+      res += (*this << w);
+  for (w = 0; w < size; w++)
+    if (digits[w] < 0)
+      res -= (*this << w);
+
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// Wallace tree: the partial products are collected in columns by weight;
+// full adders take the three oldest bits of a column and put the sum at
+// the end of the column and the carry into the next column, until a single
+// bit is left in each column
+FormulaVector FormulaVector::mulTree(const FormulaVector &fv) const {
+  vector<deque<Formula> > columns(size);
+  Formula f;
+
+  for (unsigned int i = 0; i < size; i++)
+    for (unsigned int j = 0; i + j < size; j++) {
+      f = Formula::makeAnd(bitArray[size - 1 - i], fv.bitArray[size - 1 - j]);
+      if (f.GetType() == CONST && !f.GetValue())
+        continue;
+      f.IncRefCount();
+      columns[i + j].push_back(f);
+    }
+
+  FormulaVector res(size);
+  for (unsigned int w = 0; w < size; w++) {
+    deque<Formula> &column = columns[w];
+
+    while (column.size() > 1) {
+      // a full adder on the three oldest bits of the column, or, when only
+      // two bits are left, the same adder with false as the third input
+      bool full = (column.size() > 2);
+      Formula x = column[0], y = column[1];
+      Formula z = (full ? column[2] : FormulaFactory::Instance()->GetConst(false));
+      column.erase(column.begin(), column.begin() + (full ? 3 : 2));
+
+      Formula xy = Formula::makeXor(x, y);
+      xy.IncRefCount();
+      f = Formula::makeXor(xy, z);
+      f.IncRefCount();
+      column.push_back(f);
+
+      if (w + 1 < size) {
+        f = Formula::makeOr(Formula::makeAnd(x, y), Formula::makeAnd(z, xy));
+        f.IncRefCount();
+        columns[w + 1].push_back(f);
+      }
+
+      xy.DecRefCount();
+      FormulaFactory::Instance()->Remove(xy);
+      x.DecRefCount();
+      FormulaFactory::Instance()->Remove(x);
+      y.DecRefCount();
+      FormulaFactory::Instance()->Remove(y);
+      if (full) {
+        z.DecRefCount();
+        FormulaFactory::Instance()->Remove(z);
+      }
+    }
+
+    if (!column.empty()) {
+      res.setFormulaAt(size - 1 - w, column[0]);
+      column[0].DecRefCount();
+      FormulaFactory::Instance()->Remove(column[0]);
+    }
+  }
+
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the quotient of a division by zero has all bits set and the remainder
+// is the dividend, as given by the divider
+FormulaVector FormulaVector::operator / (const FormulaVector &fv) const {
+  FormulaVector q(size), r(size);
+  divMod(fv, q, r);
+  return q;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::operator % (const FormulaVector &fv) const {
+  FormulaVector q(size), r(size);
+  divMod(fv, q, r);
+  return r;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// restoring array divider: the row for the weight i subtracts d << i from
+// the partial remainder if it fits (the bits of d of weight size - i and
+// more are zero) and is not larger than it; only the bits of weight i and
+// more take part in the row. A zero or a power of two as the divisor needs
+// no divider at all, other constants are handled by divModConst.
+void FormulaVector::divMod(const FormulaVector &d, FormulaVector &q, FormulaVector &r) const {
+  assert(size == d.getSize() && size == q.getSize() && size == r.getSize());
+
+  Formula T = FormulaFactory::Instance()->GetConst(true);
+  Formula NT = FormulaFactory::Instance()->GetConst(false);
+  unsigned int w;
+  int i;
+
+  r = *this;
+
+  if (d.isConst()) {
+    int ones = 0, k = -1;
+    for (w = 0; w < size; w++)
+      if (d.bitArray[size - 1 - w].GetValue()) {
+        ones++;
+        k = w;
+      }
+
+    if (ones == 0) {
+      for (w = 0; w < size; w++)
+        q.setFormulaAt(w, T);
+      return;
+    }
+    if (ones == 1) {
+      q = (*this >> k);
+      for (w = k; w < size; w++)
+        r.setFormulaAt(size - 1 - w, NT);
+      return;
+    }
+    divModConst(d, k, q, r);
+    return;
+  }
+
+  // over[i]: a bit of d of weight size - i or more is set
+  FormulaVector over(size), t(size);
+  for (w = 1; w < size; w++)
+    over.setFormulaAt(w, Formula::makeOr(over.bitArray[w - 1], d.bitArray[w - 1]));
+
+  for (i = size - 1; i >= 0; i--) {
+    Formula b = NT, nb, g;
+    b.IncRefCount();
+
+    // t collects y ^ b, the bits the difference differs from the remainder in
+    for (w = i; w < size; w++) {
+      Formula x = r.bitArray[size - 1 - w], y = d.bitArray[size - 1 - w + i];
+
+      t.setFormulaAt(size - 1 - w, Formula::makeXor(y, b));
+
+      nb = Formula::makeOr(Formula::makeAnd(y, b), Formula::makeAnd(Formula::makeNot(x), Formula::makeOr(y, b)));
+      nb.IncRefCount();
+      b.DecRefCount();
+      FormulaFactory::Instance()->Remove(b);
+      b = nb;
+    }
+
+    g = Formula::makeAnd(Formula::makeNot(over.bitArray[i]), Formula::makeNot(b));
+    g.IncRefCount();
+    b.DecRefCount();
+    FormulaFactory::Instance()->Remove(b);
+
+    q.setFormulaAt(size - 1 - i, g);
+    for (w = i; w < size; w++)
+      r.setFormulaAt(size - 1 - w, Formula::makeXor(r.bitArray[size - 1 - w], Formula::makeAnd(g, t.bitArray[size - 1 - w])));
+
+    g.DecRefCount();
+    FormulaFactory::Instance()->Remove(g);
+  }
+}
+
+
+// -------------------------------------------------------------------
+
+
+// long division by a constant d with the highest one of weight h: the
+// partial remainder is less than d, so it needs only h + 1 bits; each step
+// shifts the next bit of this into it and subtracts d from the h + 2 bits
+// if d is not larger than them
+void FormulaVector::divModConst(const FormulaVector &d, unsigned int h, FormulaVector &q, FormulaVector &r) const {
+  Formula NT = FormulaFactory::Instance()->GetConst(false);
+  unsigned int m = h + 2, w;
+  FormulaVector rem(m), t(m);
+
+  for (int k = size - 1; k >= 0; k--) {
+    for (w = m - 1; w > 0; w--)
+      rem.setFormulaAt(m - 1 - w, rem.bitArray[m - w]);
+    rem.setFormulaAt(m - 1, bitArray[size - 1 - k]);
+
+    Formula b = NT, nb, g;
+    b.IncRefCount();
+
+    for (w = 0; w < m; w++) {
+      Formula x = rem.bitArray[m - 1 - w], y = (w <= h ? d.bitArray[size - 1 - w] : NT);
+
+      t.setFormulaAt(m - 1 - w, Formula::makeXor(y, b));
+
+      nb = Formula::makeOr(Formula::makeAnd(y, b), Formula::makeAnd(Formula::makeNot(x), Formula::makeOr(y, b)));
+      nb.IncRefCount();
+      b.DecRefCount();
+      FormulaFactory::Instance()->Remove(b);
+      b = nb;
+    }
+
+    g = Formula::makeNot(b);
+    g.IncRefCount();
+    b.DecRefCount();
+    FormulaFactory::Instance()->Remove(b);
+
+    // the bit of weight h + 1 of the new remainder is zero
+    q.setFormulaAt(size - 1 - k, g);
+    for (w = 0; w <= h; w++)
+      rem.setFormulaAt(m - 1 - w, Formula::makeXor(rem.bitArray[m - 1 - w], Formula::makeAnd(g, t.bitArray[m - 1 - w])));
+
+    g.DecRefCount();
+    FormulaFactory::Instance()->Remove(g);
+  }
+
+  for (w = 0; w < size; w++)
+    r.setFormulaAt(size - 1 - w, (w <= h ? rem.bitArray[m - 1 - w] : NT));
 }
 
 
@@ -383,7 +822,7 @@ FormulaVector FormulaVector::operator * (const FormulaVector &fv) {
 void FormulaVector::print(void) const {
   for (unsigned int i = 0; i < size; i++) {
     cout << i+1 << ". ";
-    bitArray[i]->print();
+    bitArray[i].print();
     cout << endl;
   }
   cout << endl;
@@ -395,7 +834,7 @@ void FormulaVector::print(void) const {
 
 void FormulaVector::SetConstraint(unsigned int e_n_b) {
 
-  Formula *tmp;
+  Formula tmp;
   for (int i = size - 1; i >= 0; i--, e_n_b /= 2) {
     if (e_n_b % 2 == 0) {
       tmp = Formula::makeNot(bitArray[i]);
@@ -411,7 +850,7 @@ void FormulaVector::SetConstraint(unsigned int e_n_b) {
 
 FormulaVector& FormulaVector::operator &= (const FormulaVector &fv) {
   assert(size == fv.getSize());
-  Formula *f;
+  Formula f;
   for (unsigned int i = 0; i < size; i++) {
     f = Formula::makeAnd(bitArray[i], fv.bitArray[i]);
     setFormulaAt(i, f);
@@ -426,7 +865,7 @@ FormulaVector& FormulaVector::operator &= (const FormulaVector &fv) {
 
 FormulaVector& FormulaVector::operator ^= (const FormulaVector &fv) {
   assert(size == fv.getSize());
-  Formula *f;
+  Formula f;
   for (unsigned int i = 0; i < size; i++) {
     f = Formula::makeXor(bitArray[i], fv.bitArray[i]);
     setFormulaAt(i, f);
@@ -441,23 +880,25 @@ FormulaVector& FormulaVector::operator ^= (const FormulaVector &fv) {
 FormulaVector& FormulaVector::operator += (const FormulaVector &fv) {
   assert(size == fv.getSize());
 
-  Formula *c = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  Formula *sumF;
+  if (URSAAdder != eRippleCarry)
+    return (*this = prefixAdd(fv, false));
+
+  Formula c = FormulaFactory::Instance()->GetConst(false);
+  Formula sumF;
 
   for(int i = size - 1; i >= 0; i--) {
-    Formula *andF = NULL, *orF = NULL, *xorF = NULL;
+    Formula andF, orF, xorF;
 
     andF = Formula::makeAnd(bitArray[i], fv.bitArray[i]);
     orF = Formula::makeOr(bitArray[i], fv.bitArray[i]);
     xorF = Formula::makeXor(bitArray[i], fv.bitArray[i]);
 
-    c->IncRefCount();
+    c.IncRefCount();
     sumF = Formula::makeXor(xorF, c);
 
     setFormulaAt(i, sumF);
 
-    c->DecRefCount();
+    c.DecRefCount();
     c = Formula::makeOr(andF, Formula::makeAnd(c, orF));
   }
 
@@ -472,19 +913,23 @@ FormulaVector& FormulaVector::operator += (const FormulaVector &fv) {
 
 FormulaVector& FormulaVector::operator += (const unsigned long l) {
 
-  Formula *t = FormulaFactory::Instance()->Get(new FormulaT());
-  Formula::NEW++;
-  Formula *nt = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  Formula *c = nt;
-  Formula *sumF;
+  if (URSAAdder != eRippleCarry) {
+    FormulaVector c(size);
+    c = l;
+    return (*this = prefixAdd(c, false));
+  }
+
+  Formula t = FormulaFactory::Instance()->GetConst(true);
+  Formula nt = FormulaFactory::Instance()->GetConst(false);
+  Formula c = nt;
+  Formula sumF;
   unsigned long n = l;
 
-  t->IncRefCount();
-  nt->IncRefCount();
+  t.IncRefCount();
+  nt.IncRefCount();
 
   for(int i = size - 1; i >= 0; i--, n >>= 1) {
-    Formula *andF = NULL, *orF = NULL, *xorF = NULL;
+    Formula andF, orF, xorF;
 
     if (n & 1) {
       andF = bitArray[i];
@@ -497,17 +942,17 @@ FormulaVector& FormulaVector::operator += (const unsigned long l) {
       xorF = bitArray[i];
     }
 
-    c->IncRefCount();
+    c.IncRefCount();
     sumF = Formula::makeXor(xorF, c);
 
     setFormulaAt(i, sumF);
 
-    c->DecRefCount();
+    c.DecRefCount();
     c = Formula::makeOr(andF, Formula::makeAnd(c, orF));
   }
 
-  t->DecRefCount();
-  nt->DecRefCount();
+  t.DecRefCount();
+  nt.DecRefCount();
 
   FormulaFactory::Instance()->Remove(c);
   FormulaFactory::Instance()->Remove(t);
@@ -522,38 +967,42 @@ FormulaVector& FormulaVector::operator += (const unsigned long l) {
 
 FormulaVector& FormulaVector::operator -= (const FormulaVector &fv) {
   assert(size == fv.getSize());
-  FormulaVector minusFormulaVector(fv.getSize());
 
-  Formula *c = FormulaFactory::Instance()->Get(new FormulaNT());
-  c->IncRefCount();
-  Formula::NEW++;
-  Formula *difF;
+  if (URSAAdder != eRippleCarry)
+    return (*this = prefixAdd(fv, true));
+
+  Formula c = FormulaFactory::Instance()->GetConst(false);
+  c.IncRefCount();
+  Formula difF;
 
   for(int i = size - 1; i >= 0; i--) {
-    Formula *andF = NULL, *orF = NULL, *xorF = NULL;
+    Formula andF, orF, xorF;
 
     xorF = Formula::makeXor(bitArray[i], fv.bitArray[i]);
 
     difF = Formula::makeXor(xorF, c);
+    difF.IncRefCount();
 
-    setFormulaAt(i, difF);
-
-    c->DecRefCount();
+    c.DecRefCount();
 
-    Formula *notF = Formula::makeNot(bitArray[i]);
-    notF->IncRefCount();
+    // the borrow depends on the old bit, so the bit is replaced afterwards
+    Formula notF = Formula::makeNot(bitArray[i]);
+    notF.IncRefCount();
 
     andF = Formula::makeAnd(notF, fv.bitArray[i]);
     orF = Formula::makeOr(notF, fv.bitArray[i]);
 
     c = Formula::makeOr(andF, Formula::makeAnd(c, orF));
-    c->IncRefCount();
+    c.IncRefCount();
 
-    notF->DecRefCount();
+    notF.DecRefCount();
     FormulaFactory::Instance()->Remove(notF);
+
+    setFormulaAt(i, difF);
+    difF.DecRefCount();
   }
 
-  c->DecRefCount();
+  c.DecRefCount();
   FormulaFactory::Instance()->Remove(c);
 
   return *this;
@@ -565,25 +1014,28 @@ FormulaVector& FormulaVector::operator -= (const FormulaVector &fv) {
 
 FormulaVector FormulaVector::operator + (const FormulaVector &fv) {
   assert(size == fv.getSize());
+
+  if (URSAAdder != eRippleCarry)
+    return prefixAdd(fv, false);
+
   FormulaVector plusFormulaVector(fv.getSize());
 
-  Formula *c = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  Formula *sumF;
+  Formula c = FormulaFactory::Instance()->GetConst(false);
+  Formula sumF;
 
   for(int i = size - 1; i >= 0; i--) {
-    Formula *andF = NULL, *orF = NULL, *xorF = NULL;
+    Formula andF, orF, xorF;
 
     andF = Formula::makeAnd(bitArray[i], fv.bitArray[i]);
     orF = Formula::makeOr(bitArray[i], fv.bitArray[i]);
     xorF = Formula::makeXor(bitArray[i], fv.bitArray[i]);
 
-    c->IncRefCount();
+    c.IncRefCount();
     sumF = Formula::makeXor(xorF, c);
 
     plusFormulaVector.setFormulaAt(i, sumF);
 
-    c->DecRefCount();
+    c.DecRefCount();
     c = Formula::makeOr(andF, Formula::makeAnd(c, orF));
   }
 
@@ -596,17 +1048,106 @@ FormulaVector FormulaVector::operator + (const FormulaVector &fv) {
 // -------------------------------------------------------------------
 
 
+FormulaVector FormulaVector::operator + (const GroundNumber &c) const {
+  return addConst(c, false, false);
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::operator - (const GroundNumber &c) const {
+  return addConst(c, true, false);
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector FormulaVector::subtractFrom(const GroundNumber &c) const {
+  return addConst(c, true, true);
+}
+
+
+// -------------------------------------------------------------------
+
+
+// this + c, this - c or (reverse) c - this, with the bits of c deciding the
+// gates: in the ripple chain the carry (or the borrow) out of a bit is a
+// single AND or OR of the bit of this and the carry into it, and in the
+// prefix adders each p is a literal and each g a literal or a constant.
+// These are the gates that the general adders fold into for a constant.
+FormulaVector FormulaVector::addConst(const GroundNumber &c, bool subtract, bool reverse) const {
+  unsigned int w;
+
+  if (URSAAdder != eRippleCarry) {
+    // x + y (+ 1 for a subtraction), where x is this or c and y is the
+    // other operand or its complement
+    FormulaVector p(size), g(size);
+    for (w = 0; w < size; w++) {
+      Formula l = bitArray[size - 1 - w];
+      bool k = c.Bit(w);
+      if (reverse)
+        l = Formula::makeNot(l);
+      else if (subtract)
+        k = !k;
+      p.setFormulaAt(w, k ? Formula::makeNot(l) : l);
+      if (w == 0 && subtract)
+        g.setFormulaAt(w, k ? FormulaFactory::Instance()->GetConst(true) : l);
+      else if (k)
+        g.setFormulaAt(w, l);
+    }
+    return prefixSum(p, g, subtract);
+  }
+
+  FormulaVector res(size);
+  Formula c0 = FormulaFactory::Instance()->GetConst(false), f;
+  c0.IncRefCount();
+
+  for (w = 0; w < size; w++) {
+    Formula x = bitArray[size - 1 - w];
+    bool k = c.Bit(w);
+
+    res.setFormulaAt(size - 1 - w, Formula::makeXor(k ? Formula::makeNot(x) : x, c0));
+
+    // the carry of x + k is x | c0 if k and x & c0 otherwise; the borrow
+    // of x - k is the same for ~x, and the borrow of k - x is the carry of
+    // x + ~k
+    Formula y = (subtract && !reverse ? Formula::makeNot(x) : x);
+    if (k != reverse)
+      f = Formula::makeOr(y, c0);
+    else
+      f = Formula::makeAnd(y, c0);
+    f.IncRefCount();
+    c0.DecRefCount();
+    FormulaFactory::Instance()->Remove(c0);
+    c0 = f;
+  }
+
+  c0.DecRefCount();
+  FormulaFactory::Instance()->Remove(c0);
+
+  return res;
+}
+
+
+// -------------------------------------------------------------------
+
+
 FormulaVector FormulaVector::operator - (const FormulaVector &fv) {
   assert(size == fv.getSize());
+
+  if (URSAAdder != eRippleCarry)
+    return prefixAdd(fv, true);
+
   FormulaVector minusFormulaVector(fv.getSize());
 
-  Formula *c = FormulaFactory::Instance()->Get(new FormulaNT());
-  c->IncRefCount();
-  Formula::NEW++;
-  Formula *difF;
+  Formula c = FormulaFactory::Instance()->GetConst(false);
+  c.IncRefCount();
+  Formula difF;
 
   for(int i = size - 1; i >= 0; i--) {
-    Formula *andF = NULL, *orF = NULL, *xorF = NULL;
+    Formula andF, orF, xorF;
 
     xorF = Formula::makeXor(bitArray[i], fv.bitArray[i]);
 
@@ -614,22 +1155,22 @@ FormulaVector FormulaVector::operator - (const FormulaVector &fv) {
 
     minusFormulaVector.setFormulaAt(i, difF);
 
-    c->DecRefCount();
+    c.DecRefCount();
 
-    Formula *notF = Formula::makeNot(bitArray[i]);
-    notF->IncRefCount();
+    Formula notF = Formula::makeNot(bitArray[i]);
+    notF.IncRefCount();
 
     andF = Formula::makeAnd(notF, fv.bitArray[i]);
     orF = Formula::makeOr(notF, fv.bitArray[i]);
 
     c = Formula::makeOr(andF, Formula::makeAnd(c, orF));
-    c->IncRefCount();
+    c.IncRefCount();
 
-    notF->DecRefCount();
+    notF.DecRefCount();
     FormulaFactory::Instance()->Remove(notF);
   }
 
-  c->DecRefCount();
+  c.DecRefCount();
   FormulaFactory::Instance()->Remove(c);
 
   return minusFormulaVector;
@@ -639,10 +1180,84 @@ FormulaVector FormulaVector::operator - (const FormulaVector &fv) {
 // -------------------------------------------------------------------
 
 
-Formula* FormulaVector::doAnd(void) {
+// this + fv, or this - fv computed as this + ~fv + 1. The pair (g, p) of
+// a group of bits tells whether the group generates a carry and whether it
+// propagates one; the carry into the bit i is the g of the bits below i
+// (the carry in is included in the g of the bit 0). Kogge-Stone combines
+// the groups ending at each bit with the groups next to them, doubling
+// their lengths in each level; Brent-Kung combines pairs of groups in a
+// tree and then fills in the missing carries, with fewer operators.
+// g and p are indexed by weight.
+FormulaVector FormulaVector::prefixAdd(const FormulaVector &fv, bool subtract) const {
+  assert(size == fv.getSize());
+
+  FormulaVector p(size), g(size);
+
+  for (unsigned int i = 0; i < size; i++) {
+    Formula x = bitArray[size - 1 - i], y = fv.bitArray[size - 1 - i];
+    if (subtract)
+      y = Formula::makeNot(y);
+    p.setFormulaAt(i, Formula::makeXor(x, y));
+    if (i == 0 && subtract)
+      g.setFormulaAt(i, Formula::makeOr(x, y));
+    else
+      g.setFormulaAt(i, Formula::makeAnd(x, y));
+  }
+
+  return prefixSum(p, g, subtract);
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the carries of the bits with the given p and g (by weight), by the
+// chosen parallel-prefix network, and the sum; the carry in is 1 for a
+// subtraction
+FormulaVector FormulaVector::prefixSum(FormulaVector &p, FormulaVector &g, bool subtract) {
+  unsigned int size = p.getSize();
+  FormulaVector gp(p), res(size);
+  unsigned int i, d;
+
+  // only the carries into the bits up to size - 1 are needed
+  unsigned int n = size - 1;
+
+  if (URSAAdder == eKoggeStone) {
+    for (d = 1; d < n; d <<= 1)
+      for (i = n - 1; i >= d; i--) {
+        g.setFormulaAt(i, Formula::makeOr(g.bitArray[i], Formula::makeAnd(gp.bitArray[i], g.bitArray[i - d])));
+        // the groups reaching the bit 0 are not combined any more
+        if (i >= 2 * d)
+          gp.setFormulaAt(i, Formula::makeAnd(gp.bitArray[i], gp.bitArray[i - d]));
+      }
+  }
+  else {
+    for (d = 1; d < n; d <<= 1)
+      for (i = 2 * d - 1; i < n; i += 2 * d) {
+        g.setFormulaAt(i, Formula::makeOr(g.bitArray[i], Formula::makeAnd(gp.bitArray[i], g.bitArray[i - d])));
+        gp.setFormulaAt(i, Formula::makeAnd(gp.bitArray[i], gp.bitArray[i - d]));
+      }
+    for (d >>= 1; d >= 1; d >>= 1)
+      for (i = 3 * d - 1; i < n; i += 2 * d) {
+        g.setFormulaAt(i, Formula::makeOr(g.bitArray[i], Formula::makeAnd(gp.bitArray[i], g.bitArray[i - d])));
+        gp.setFormulaAt(i, Formula::makeAnd(gp.bitArray[i], gp.bitArray[i - d]));
+      }
+  }
+
+  Formula c = FormulaFactory::Instance()->GetConst(subtract);
+  for (i = 0; i < size; i++)
+    res.setFormulaAt(size - 1 - i, Formula::makeXor(p.bitArray[i], (i == 0 ? c : g.bitArray[i - 1])));
+
+  return res;
+}
 
-  Formula *f = FormulaFactory::Instance()->Get(new FormulaT());
-  Formula::NEW++;
+
+// -------------------------------------------------------------------
+
+
+Formula FormulaVector::doAnd(void) {
+
+  Formula f = FormulaFactory::Instance()->GetConst(true);
 
   for (unsigned int i = 0; i < size; i++)
     f = Formula::makeAnd(f, bitArray[i]);
@@ -654,10 +1269,9 @@ Formula* FormulaVector::doAnd(void) {
 // -------------------------------------------------------------------
 
 
-Formula* FormulaVector::doOr(void) {
+Formula FormulaVector::doOr(void) {
 
-  Formula *f = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
+  Formula f = FormulaFactory::Instance()->GetConst(false);
 
   for (unsigned int i = 0; i < size; i++)
     f = Formula::makeOr(f, bitArray[i]);
@@ -679,21 +1293,58 @@ void FormulaVector::setFormulaVectorAt(const FormulaVector &fv, unsigned int k)
 // -------------------------------------------------------------------
 
 
-FormulaVector1 FormulaVector::operator < (const FormulaVector &fv) {
-  assert(size == fv.getSize());
+// a < b is built from the least significant bit up: up to the bit i,
+// a < b iff a_i < b_i, or a_i == b_i and a < b below i. If one of the bits
+// is constant, this is the majority of ~a_i, b_i and the result below i,
+// which folds into a single gate; otherwise it is selected by a_i ^ b_i,
+// which == and != (and the adders) on the same bits share. <, >, <= and >=
+// are all this chain for one or the other order of the operands, so a < b
+// and a >= b (or a > b and b < a) share one comparator.
+// For two's complement numbers the sign bits compare the other way round,
+// so the signed chain only swaps the operands at the highest bit and
+// shares the rest with the unsigned one.
+Formula FormulaVector::lessThan(const FormulaVector &a, const FormulaVector &b, bool bSigned) {
+  assert(a.getSize() == b.getSize());
+
+  Formula lt = FormulaFactory::Instance()->GetConst(false), f;
+  lt.IncRefCount();
+
+  for (int i = a.getSize() - 1; i >= 0; i--) {
+    Formula ai = a.bitArray[i], bi = b.bitArray[i];
+    if (bSigned && i == 0) {
+      ai = b.bitArray[i];
+      bi = a.bitArray[i];
+    }
+    Formula x = Formula::makeNot(ai), y = bi;
+    if (x.GetType() == CONST || y.GetType() == CONST)
+      f = Formula::makeOr(Formula::makeAnd(x, y), Formula::makeAnd(lt, Formula::makeOr(x, y)));
+    else {
+      // d is used twice, it must survive the folding of the first use
+      Formula d = Formula::makeXor(ai, y);
+      d.IncRefCount();
+      f = Formula::makeOr(Formula::makeAnd(d, y), Formula::makeAnd(Formula::makeNot(d), lt));
+      f.IncRefCount();
+      d.DecRefCount();
+      FormulaFactory::Instance()->Remove(d);
+      f.DecRefCount();
+    }
+    f.IncRefCount();
+    lt.DecRefCount();
+    FormulaFactory::Instance()->Remove(lt);
+    lt = f;
+  }
 
-  FormulaVector1 result, r1,r2;
+  lt.DecRefCount();
+  return lt;
+}
 
-  r2 = (*this)[size-1];
-  r1 = fv[size-1];
-  result = (r1 & ~r2);
 
-  for(int i=size-2;i>=0;i--) {
-    r2 = (*this)[i];
-    r1 = fv[i];
-    result = (r1 & ~r2) | (result & (r1==r2));
-  }
- 
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator < (const FormulaVector &fv) {
+  FormulaVector1 result;
+  result = lessThan(*this, fv, false);
   return result;
 }
 
@@ -702,18 +1353,8 @@ FormulaVector1 FormulaVector::operator < (const FormulaVector &fv) {
 
 
 FormulaVector1 FormulaVector::operator > (const FormulaVector &fv) {
-  assert(size == fv.getSize());
-  FormulaVector1 result, r1,r2;
-
-  r1 = (*this)[size-1];
-  r2 = fv[size-1];
-  result = (r1 & ~r2);
-
-  for(int i=size-2;i>=0;i--) {
-    r1 = (*this)[i];
-    r2 = fv[i];
-    result = (r1 & ~r2) | (result & (r1==r2));
-  }
+  FormulaVector1 result;
+  result = lessThan(fv, *this, false);
   return result;
 }
 
@@ -722,7 +1363,9 @@ FormulaVector1 FormulaVector::operator > (const FormulaVector &fv) {
 
 
 FormulaVector1 FormulaVector::operator <= (const FormulaVector &fv) {
-  return ~(*this>fv);
+  FormulaVector1 result;
+  result = Formula::makeNot(lessThan(fv, *this, false));
+  return result;
 }
 
 
@@ -730,23 +1373,36 @@ FormulaVector1 FormulaVector::operator <= (const FormulaVector &fv) {
 
 
 FormulaVector1 FormulaVector::operator >= (const FormulaVector &fv) {
-  return ~(*this<fv);
+  FormulaVector1 result;
+  result = Formula::makeNot(lessThan(*this, fv, false));
+  return result;
 }
 
 
 // -------------------------------------------------------------------
 
 
-FormulaVector1 FormulaVector::operator == (const FormulaVector &fv) {
+// the conjunction of the equivalences of the bits; against a constant the
+// equivalences are literals, so a == c is a single conjunction of literals
+// (one clause per bit and one for the whole in the CNF). a != b is its
+// negation, so == and != on the same operands share it.
+Formula FormulaVector::equalTo(const FormulaVector &fv) const {
   assert(size == fv.getSize());
 
-  FormulaVector1 result, r;
-  result = Formula::makeEquiv(bitArray[0], fv.bitArray[0]);
-  for (unsigned int i = 1; i < size; i++) {
-    r = Formula::makeEquiv(bitArray[i], fv.bitArray[i]);
-    result = result & r;
-  }
+  Formula eq = FormulaFactory::Instance()->GetConst(true);
+  for (unsigned int i = 0; i < size; i++)
+    eq = Formula::makeAnd(eq, Formula::makeEquiv(bitArray[i], fv.bitArray[i]));
+
+  return eq;
+}
+
+
+// -------------------------------------------------------------------
+
 
+FormulaVector1 FormulaVector::operator == (const FormulaVector &fv) {
+  FormulaVector1 result;
+  result = equalTo(fv);
   return result;
 }
 
@@ -755,16 +1411,148 @@ FormulaVector1 FormulaVector::operator == (const FormulaVector &fv) {
 
 
 FormulaVector1 FormulaVector::operator != (const FormulaVector &fv) {
-  assert(size == fv.getSize());
+  FormulaVector1 result;
+  result = Formula::makeNot(equalTo(fv));
+  return result;
+}
 
-  FormulaVector1 result, r;
 
-  result = Formula::makeXor(bitArray[0], fv.bitArray[0]);
-  for (unsigned int i = 1; i < size; i++) {
-    r = Formula::makeXor(bitArray[i], fv.bitArray[i]);
-    result = result | r;
+// -------------------------------------------------------------------
+
+
+// this < c (or this > c) by the chain of lessThan, in which each bit of c
+// decides whether the result up to the bit is an OR or an AND of the
+// result below it and a literal; a signed comparison is the unsigned one
+// with the sign bits of both operands flipped
+Formula FormulaVector::lessThanConst(const GroundNumber &c, bool greater, bool bSigned) const {
+  Formula lt = FormulaFactory::Instance()->GetConst(false), f;
+  lt.IncRefCount();
+
+  for (unsigned int w = 0; w < size; w++) {
+    Formula x = bitArray[size - 1 - w];
+    bool k = c.Bit(w);
+    if (bSigned && w == size - 1) {
+      x = Formula::makeNot(x);
+      k = !k;
+    }
+    if (!greater)
+      x = Formula::makeNot(x);
+    if (k != greater)
+      f = Formula::makeOr(x, lt);
+    else
+      f = Formula::makeAnd(x, lt);
+    f.IncRefCount();
+    lt.DecRefCount();
+    FormulaFactory::Instance()->Remove(lt);
+    lt = f;
   }
 
+  lt.DecRefCount();
+  return lt;
+}
+
+
+// -------------------------------------------------------------------
+
+
+Formula FormulaVector::equalToConst(const GroundNumber &c) const {
+  Formula eq = FormulaFactory::Instance()->GetConst(true);
+  for (unsigned int i = 0; i < size; i++) {
+    Formula x = bitArray[i];
+    eq = Formula::makeAnd(eq, c.Bit(size - 1 - i) ? x : Formula::makeNot(x));
+  }
+
+  return eq;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator < (const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = lessThanConst(c, false, false);
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator > (const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = lessThanConst(c, true, false);
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator <= (const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = Formula::makeNot(lessThanConst(c, true, false));
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator >= (const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = Formula::makeNot(lessThanConst(c, false, false));
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator == (const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = equalToConst(c);
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::operator != (const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = Formula::makeNot(equalToConst(c));
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+// the signed (two's complement) comparisons; a <= b is ~(b < a)
+FormulaVector1 FormulaVector::lessSigned(const FormulaVector &fv) const {
+  FormulaVector1 result;
+  result = lessThan(*this, fv, true);
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::lessSigned(const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = lessThanConst(c, false, true);
+  return result;
+}
+
+
+// -------------------------------------------------------------------
+
+
+FormulaVector1 FormulaVector::greaterSigned(const GroundNumber &c) const {
+  FormulaVector1 result;
+  result = lessThanConst(c, true, true);
   return result;
 }
 
@@ -773,10 +1561,8 @@ FormulaVector1 FormulaVector::operator != (const FormulaVector &fv) {
 
 
 FormulaVector1& FormulaVector1::operator = (unsigned long n) {
-  Formula *NT = FormulaFactory::Instance()->Get(new FormulaNT());
-  Formula::NEW++;
-  Formula *T = FormulaFactory::Instance()->Get(new FormulaT());
-  Formula::NEW++;
+  Formula NT = FormulaFactory::Instance()->GetConst(false);
+  Formula T = FormulaFactory::Instance()->GetConst(true);
 
   if (n%2)
     setFormulaAt(size - 1, T);
@@ -797,7 +1583,7 @@ FormulaVector FormulaVector::ite(const FormulaVector &fv1, const FormulaVector &
   assert(size == 1);
 
   FormulaVector result(fv1.size);
-  Formula *r1,*r2,*r3;
+  Formula r1,r2,r3;
   for(unsigned i=0; i < fv1.size; i++) {
     if(fv1.bitArray[i]==fv2.bitArray[i])
       result.setFormulaAt(i,fv1.bitArray[i]);
@@ -857,7 +1643,7 @@ FormulaVector::operator FormulaVector1() {
 // -------------------------------------------------------------------
 
 
-FormulaVector1& FormulaVector1::operator = (Formula *f) {
+FormulaVector1& FormulaVector1::operator = (Formula f) {
   assert(size == 1);
   setFormulaAt(0, f);
   return *this;
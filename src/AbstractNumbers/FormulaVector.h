@@ -25,6 +25,12 @@ using namespace std;
 
 extern unsigned int iAbstractNumberLength;
 
+// the carries of additions and subtractions are computed by a ripple
+// chain or by a parallel-prefix network (Kogge-Stone or Brent-Kung), which
+// has logarithmic depth
+typedef enum { eRippleCarry, eKoggeStone, eBrentKung } eAdders;
+extern eAdders URSAAdder;
+
 
 class FormulaVector1;
 
@@ -40,28 +46,34 @@ public:
   FormulaVector(unsigned int n);
   FormulaVector(unsigned int n, bool b);
   FormulaVector(const FormulaVector &fv);
-  FormulaVector(const GroundNumber &n);
+  // a temporary gives its formulas away, with no reference counting
+  FormulaVector(FormulaVector &&fv);
+  explicit FormulaVector(const GroundNumber &n);
 
   ~FormulaVector();
 
   void init(unsigned int n);
   void initDefined(unsigned int n); /* original vars are not to be neglected, even if irrelevant */
+  void initDefined(unsigned int n, unsigned int width, bool bSigned); /* narrow number, extended to the size */
 
   FormulaVector& operator = (unsigned long n);
   FormulaVector& operator = (const GroundNumber &n);
   FormulaVector& operator = (const unsigned char n[]);
   FormulaVector& operator = (const FormulaVector &fv);
+  FormulaVector& operator = (FormulaVector &&fv);
 
-  void setFormulaAt(unsigned int i, Formula *f);
+  void setFormulaAt(unsigned int i, Formula f);
   void setFormulaVectorAt(const FormulaVector &fv, unsigned int k);
-  Formula* getFormulaFrom(unsigned int i) const;
-  Formula* operator [] (unsigned int i) const;
+  Formula getFormulaFrom(unsigned int i) const;
+  Formula operator [] (unsigned int i) const;
 
   FormulaVector operator ~ () const;
   FormulaVector& operator &= (const FormulaVector &fv);
   FormulaVector& operator ^= (const FormulaVector &fv);
   FormulaVector operator << (unsigned int k) const;
   FormulaVector operator >> (unsigned int k) const;
+  FormulaVector operator << (const FormulaVector &s) const;
+  FormulaVector operator >> (const FormulaVector &s) const;
   FormulaVector operator | (const FormulaVector &fv) const;
   FormulaVector operator ^ (const FormulaVector &fv) const;
   FormulaVector operator & (const FormulaVector &fv) const;
@@ -71,15 +83,36 @@ public:
   FormulaVector& operator += (const unsigned long n);
   FormulaVector& operator -= (const FormulaVector &fv);
   FormulaVector operator * (const FormulaVector &fv);
+  FormulaVector operator / (const FormulaVector &fv) const;
+  FormulaVector operator % (const FormulaVector &fv) const;
   FormulaVector operator + (const FormulaVector &fv);
   FormulaVector operator - (const FormulaVector &fv);
 
+  // the same operations with a ground operand, whose bits are read directly
+  // instead of being turned into constant formulas first
+  FormulaVector operator + (const GroundNumber &c) const;
+  FormulaVector operator - (const GroundNumber &c) const;
+  FormulaVector subtractFrom(const GroundNumber &c) const; /* c - this */
+  FormulaVector operator * (const GroundNumber &c) const;
+  FormulaVector operator & (const GroundNumber &c) const;
+  FormulaVector operator | (const GroundNumber &c) const;
+  FormulaVector operator ^ (const GroundNumber &c) const;
+
   FormulaVector1 operator < (const FormulaVector &fv);
   FormulaVector1 operator > (const FormulaVector &fv);
   FormulaVector1 operator <= (const FormulaVector &fv);
   FormulaVector1 operator >= (const FormulaVector &fv);
   FormulaVector1 operator == (const FormulaVector &fv);
   FormulaVector1 operator != (const FormulaVector &fv);
+  FormulaVector1 operator < (const GroundNumber &c) const;
+  FormulaVector1 operator > (const GroundNumber &c) const;
+  FormulaVector1 operator <= (const GroundNumber &c) const;
+  FormulaVector1 operator >= (const GroundNumber &c) const;
+  FormulaVector1 operator == (const GroundNumber &c) const;
+  FormulaVector1 operator != (const GroundNumber &c) const;
+  FormulaVector1 lessSigned(const FormulaVector &fv) const;
+  FormulaVector1 lessSigned(const GroundNumber &c) const;
+  FormulaVector1 greaterSigned(const GroundNumber &c) const;
 
   FormulaVector ite(const FormulaVector &fv1, const FormulaVector &fv2) const;
   FormulaVector sgn() const;
@@ -91,14 +124,36 @@ public:
 
   void SetConstraint(unsigned int);
 
-  Formula* doAnd(void);
-  Formula* doOr(void);
+  Formula doAnd(void);
+  Formula doOr(void);
 
   unsigned int getSize(void) const { return size; };
+  bool isConst(void) const;
 
 protected:
-  Formula** bitArray;
+  FormulaVector barrelShift(const FormulaVector &s, bool left) const;
+  static Formula lessThan(const FormulaVector &a, const FormulaVector &b, bool bSigned);
+  Formula equalTo(const FormulaVector &fv) const;
+  Formula lessThanConst(const GroundNumber &c, bool greater, bool bSigned) const;
+  Formula equalToConst(const GroundNumber &c) const;
+  FormulaVector prefixAdd(const FormulaVector &fv, bool subtract) const;
+  FormulaVector addConst(const GroundNumber &c, bool subtract, bool reverse) const;
+  static FormulaVector prefixSum(FormulaVector &p, FormulaVector &g, bool subtract);
+  FormulaVector mulConst(const vector<int> &bits) const;
+  FormulaVector mulTree(const FormulaVector &fv) const;
+  void divMod(const FormulaVector &d, FormulaVector &q, FormulaVector &r) const;
+  void divModConst(const FormulaVector &d, unsigned int h, FormulaVector &q, FormulaVector &r) const;
+
+  // up to INLINE_BITS formulas (numbers up to 64 bits and all booleans)
+  // are stored in the object itself, so temporaries need no heap memory
+  enum { INLINE_BITS = 64 };
+
+  void Allocate(unsigned int n);
+  void Swap(FormulaVector &fv);
+
+  Formula *bitArray;
   unsigned int size;
+  Formula inlineBits[INLINE_BITS];
 
 };
 
@@ -109,7 +164,7 @@ public:
   FormulaVector1& operator = (unsigned long n);
 
   FormulaVector1() : FormulaVector(1) {}
-  FormulaVector1& operator = (Formula *w);
+  FormulaVector1& operator = (Formula w);
 };
 
 
@@ -14,87 +14,100 @@ GNU General Public License for more details.
 **************************************************************************************/
 
 #include <string.h>
+#include <ctype.h>
+#include <limits.h>
 #include <GroundNumber.hpp>
 #include <Boolean.hpp>
 
 extern unsigned int iAbstractNumberLength;
 
+  void GroundNumber::Allocate(unsigned int len) {
+    m_nLen = len;
+    m_pLimbs = (len <= INLINE_LIMBS ? m_aInline : new Limb[len]);
+  }
+
+
   GroundNumber::GroundNumber() { 
-    m_nLen = (iAbstractNumberLength+7)/8; 
-    m_pDigits = new unsigned char[m_nLen];
+    Allocate((iAbstractNumberLength+63)/64); 
     for(unsigned int i=0;i<m_nLen;i++) 
-      m_pDigits[i] = 0;
+      m_pLimbs[i] = 0;
   }  
   
 
-  GroundNumber::GroundNumber(unsigned int n) { 
-    m_nLen = (iAbstractNumberLength+7)/8;  
-    m_pDigits = new unsigned char[m_nLen];
-    for(unsigned int i=0;i<sizeof(unsigned int) && i<m_nLen;i++) 
-      m_pDigits[i] = n >> (8*i);
-    for(unsigned int i=sizeof(unsigned int);i<m_nLen;i++) 
-      m_pDigits[i] = 0;
+  GroundNumber::GroundNumber(unsigned long n) { 
+    Allocate((iAbstractNumberLength+63)/64);
+    m_pLimbs[0] = n;
+    for(unsigned int i=1;i<m_nLen;i++) 
+      m_pLimbs[i] = 0;
     TruncateToSize();  
 }   
 
   GroundNumber::GroundNumber(const GroundNumber& n) {
-    m_nLen = n.m_nLen;  
-    m_pDigits = new unsigned char[m_nLen];
+    Allocate(n.m_nLen);
     for(unsigned int i=0;i<m_nLen;i++) 
-      m_pDigits[i] = n.m_pDigits[i];
-    TruncateToSize();  
+      m_pLimbs[i] = n.m_pLimbs[i];
   }    
 
-  GroundNumber::~GroundNumber() {  delete [] m_pDigits; }
+  GroundNumber::~GroundNumber() {  
+    if(m_pLimbs != m_aInline)
+      delete [] m_pLimbs; 
+  }
 
-  GroundNumber& GroundNumber::operator = (GroundNumber n) { 
-  for(unsigned int i=0;i<m_nLen;i++) 
-      m_pDigits[i] = n.m_pDigits[i];
+  GroundNumber& GroundNumber::operator = (const GroundNumber &n) { 
+    for(unsigned int i=0;i<m_nLen;i++) 
+      m_pLimbs[i] = (i<n.m_nLen ? n.m_pLimbs[i] : 0);
     return *this;
   }
 
-  GroundNumber& GroundNumber::operator = (unsigned int n) { 
-    for(unsigned int i=0;i<sizeof(unsigned int) && i<m_nLen;i++) { 
-      m_pDigits[i] = (n >> (8*i));
+  GroundNumber& GroundNumber::operator = (GroundNumber &&n) { 
+    if(m_nLen == n.m_nLen && m_pLimbs != m_aInline) {
+      Limb* p = m_pLimbs;
+      m_pLimbs = n.m_pLimbs;
+      n.m_pLimbs = p;
+      return *this;
     }
+    return (*this = (const GroundNumber&)n);
+  }
+
+  GroundNumber& GroundNumber::operator = (unsigned long n) { 
+    m_pLimbs[0] = n;
+    for(unsigned int i=1;i<m_nLen;i++) 
+      m_pLimbs[i] = 0;
     TruncateToSize();   
     return *this;
   }
 
 
   GroundNumber& GroundNumber::operator = (char* s) { 
-    unsigned int i;
+    unsigned int i, k, l=strlen(s);
     for(i=0;i<m_nLen;i++) 
-      m_pDigits[i] = 0;
+      m_pLimbs[i] = 0;
 
     // hex constant
     if(s[0]=='0' && s[1]=='x') { 
-      unsigned int l=strlen(s);
-      for( i=l-1 ; i>1 ; i--) { 
-         if ( (l-i) % 2 )
-           m_pDigits[(l-i-1)/2]  = isdigit(s[i]) ? s[i]-'0' : toupper(s[i])-'A'+10;
-         else
-           m_pDigits[(l-i-1)/2] |= 16*(isdigit(s[i]) ? s[i]-'0' : toupper(s[i])-'A'+10);
-      }
+      for(i=l-1, k=0; i>1 && k<64*m_nLen; i--, k+=4) 
+         m_pLimbs[k/64] |= (Limb)(isdigit(s[i]) ? s[i]-'0' : toupper(s[i])-'A'+10) << (k%64);
     }
 
     // bin constant
     else if(s[0]=='0' && s[1]=='b') { 
-      unsigned int l=strlen(s);
-      for( i=l-1 ; i>1 ; i--)  
-         m_pDigits[(l-i-1)/8] |= (s[i]-'0') << ((l-i-1) % 8);
+      for(i=l-1, k=0; i>1 && k<64*m_nLen; i--, k++) 
+         m_pLimbs[k/64] |= (Limb)(s[i]-'0') << (k%64);
     }
 
-    // dec constant
+    // dec constant, up to 19 digits at a time: this = this*10^k + the k digits
     else  {
-      GroundNumber tmp1, tmp2;
-      *this = (unsigned int)0;
-      tmp2 = (unsigned int)10;
-      unsigned int l=strlen(s);
-      for(i=0;i<l;i++) { 
-         *this = *this * tmp2;
-         tmp1 = (unsigned int)(s[i]-'0');
-         *this = *this + tmp1;
+      for(i=0;i<l;) { 
+         Limb carry = 0, scale = 1;
+         for(k=0; k<19 && i<l; k++, i++) {
+           carry = carry*10 + (s[i]-'0');
+           scale *= 10;
+         }
+         for(k=0;k<m_nLen;k++) {
+           unsigned __int128 t = (unsigned __int128)m_pLimbs[k]*scale + carry;
+           m_pLimbs[k] = (Limb)t;
+           carry = (Limb)(t >> 64);
+         }
       }    
     }
 
@@ -106,8 +119,12 @@ extern unsigned int iAbstractNumberLength;
 	  
   GroundNumber GroundNumber::negate() const {  
      GroundNumber m(*this);
-     for(unsigned int i=0;i<m_nLen;i++) 
-        m.m_pDigits[i] = (unsigned int)0-m_pDigits[i];
+     bool borrow = false;
+     for(unsigned int i=0;i<m_nLen;i++) { 
+        m.m_pLimbs[i] = (Limb)0-m_pLimbs[i]-borrow;
+        borrow = borrow || m_pLimbs[i]!=0;
+     }
+     m.TruncateToSize();
      return m; 
   } 
 
@@ -115,24 +132,25 @@ extern unsigned int iAbstractNumberLength;
   GroundNumber GroundNumber::bitnegate() const {  
      GroundNumber m(*this);
      for(unsigned int i=0;i<m_nLen;i++) 
-        m.m_pDigits[i] = ~m_pDigits[i];
+        m.m_pLimbs[i] = ~m_pLimbs[i];
+     m.TruncateToSize();
      return m;
   } 
 
 
+  unsigned int GroundNumber::ShiftAmount() const { 
+    unsigned long n = GetGroundValueUnsigned();
+    return (n<iAbstractNumberLength ? (unsigned int)n : iAbstractNumberLength);
+  }
+
+
   GroundNumber GroundNumber::operator << (const GroundNumber &n) { 
-    GroundNumber m(*this);              
-    //assert(n.IsGroundNumber());
-    unsigned int shift = n.GetGroundValueUnsigned(); 
-    unsigned char carry, carry_next;
-    for(unsigned int i=0;i<shift;i++)  {
-      carry=0;
-      for(unsigned int j=0;j<m_nLen;j++) { 
-        carry_next = (m.m_pDigits[j]>>7);
-        m.m_pDigits[j] <<= 1;
-        m.m_pDigits[j] |= carry;
-        carry=carry_next;
-      }
+    GroundNumber m;              
+    unsigned int shift = n.ShiftAmount(), l = shift/64, b = shift%64; 
+    for(unsigned int i=l;i<m_nLen;i++) { 
+      m.m_pLimbs[i] = m_pLimbs[i-l] << b;
+      if(b && i>l)
+        m.m_pLimbs[i] |= m_pLimbs[i-l-1] >> (64-b);
     }
     m.TruncateToSize();
     return m;                           
@@ -140,20 +158,12 @@ extern unsigned int iAbstractNumberLength;
 
 
   GroundNumber GroundNumber::operator >> (const GroundNumber &n) { 
-    GroundNumber m(*this);                           
-    //assert(n.IsGroundNumber());
-
-    unsigned int shift = n.GetGroundValueUnsigned();
-    m.TruncateToSize();
-    unsigned char carry, carry_next;
-    for(unsigned int i=0;i<shift;i++)  {
-      carry=0;
-      for(int j=m_nLen-1;j>=0;j--) { 
-        carry_next = (m.m_pDigits[j] & 1);
-        m.m_pDigits[j] >>= 1;
-        m.m_pDigits[j] |= (carry << 7);
-        carry = carry_next;
-      }
+    GroundNumber m;                           
+    unsigned int shift = n.ShiftAmount(), l = shift/64, b = shift%64;
+    for(unsigned int i=0;i+l<m_nLen;i++) { 
+      m.m_pLimbs[i] = m_pLimbs[i+l] >> b;
+      if(b && i+l+1<m_nLen)
+        m.m_pLimbs[i] |= m_pLimbs[i+l+1] << (64-b);
     }
     return m;                           
   }
@@ -161,22 +171,20 @@ extern unsigned int iAbstractNumberLength;
  
   GroundNumber GroundNumber::sgn() const {
     GroundNumber m;
-    m.m_pDigits[0]=0;
-    for(unsigned int i=0;i<m_nLen;i++) 
-       m.m_pDigits[0] = m.m_pDigits[0] || (m_pDigits[i]!=0);
-     return m;
+    m.m_pLimbs[0] = Bool();
+    return m;
   }
 
 
   bool GroundNumber::Bool() const {                           
      for(unsigned int i=0;i<m_nLen;i++) 
-        if (m_pDigits[i]!=0)
+        if (m_pLimbs[i]!=0)
            return true;
      return false;
   }
 
   bool GroundNumber::Bit(unsigned int i) const {
-     return (m_pDigits[i/8]>>(i%8)) & 1;  
+     return (m_pLimbs[i/64]>>(i%64)) & 1;  
   }
 
 
@@ -190,16 +198,16 @@ extern unsigned int iAbstractNumberLength;
 
       default:   // decimal 
         // print value in the decimal form if it can fit into unsigned int, otherwise print in the hex form
-        if(m_nLen<=sizeof(unsigned int)) {
+        if(iAbstractNumberLength<=8*sizeof(unsigned int)) {
           cout << GetGroundValueUnsigned();
           break;
         }
        
-      case('x'): // hex
+      case('x'): // hex, two digits for each byte
         cout << "0x";
-        for(int i=m_nLen-1;i>=0;i--) { 
-          cout << (char)((m_pDigits[i]>>4) >=10 ? 'A'+(m_pDigits[i]>>4)-10 : '0'+(m_pDigits[i]>>4));
-          cout << (char)((m_pDigits[i]&15) >=10 ? 'A'+(m_pDigits[i]&15)-10 : '0'+(m_pDigits[i]&15)); 
+        for(int i=2*((iAbstractNumberLength+7)/8)-1;i>=0;i--) { 
+          unsigned int d = (m_pLimbs[i/16]>>(4*(i%16))) & 15;
+          cout << (char)(d>=10 ? 'A'+d-10 : '0'+d);
         }
         break;
        
@@ -209,28 +217,26 @@ extern unsigned int iAbstractNumberLength;
 
 
   void GroundNumber::list() const {  
-      for(int i=m_nLen-1;i>=0;i--) { 
-        cout << (int)m_pDigits[i] << " ";
+      for(int i=(iAbstractNumberLength+7)/8-1;i>=0;i--) { 
+        cout << (int)((m_pLimbs[i/8]>>(8*(i%8))) & 255) << " ";
       }
     cout << endl;
   }
 
 
   void GroundNumber::TruncateToSize() {
-      int mask=0;
-      unsigned int l = (!(iAbstractNumberLength%8) ? 8 : iAbstractNumberLength%8); 
-      for(unsigned int i=0;i<l;i++)
-        mask = ((mask<<1) | 1);
-      m_pDigits[m_nLen-1] &= mask;
+      unsigned int l = iAbstractNumberLength%64; 
+      if(l)
+        m_pLimbs[m_nLen-1] &= ((Limb)1<<l)-1;
   }
 
 
 GroundNumber GroundNumber::operator + (const GroundNumber &a) { 
-  GroundNumber m=0;                           
-  unsigned int carryn, carry=0;
+  GroundNumber m;                           
+  bool carry=false;
   for(unsigned int i=0;i<m_nLen;i++)  {
-    carryn = ((m_pDigits[i]+a.m_pDigits[i]+carry>=256) ? 1 : 0); 
-    m.m_pDigits[i] = m_pDigits[i]+a.m_pDigits[i]+carry;
+    bool carryn = __builtin_add_overflow(m_pLimbs[i], a.m_pLimbs[i], &m.m_pLimbs[i]);
+    carryn |= __builtin_add_overflow(m.m_pLimbs[i], (Limb)carry, &m.m_pLimbs[i]);
     carry=carryn;
   }    
   m.TruncateToSize();
@@ -238,30 +244,80 @@ GroundNumber GroundNumber::operator + (const GroundNumber &a) {
 }  
 
 
+// only the products of the limbs of weight less than the width are needed
 GroundNumber GroundNumber::operator * (const GroundNumber &a) { 
-  GroundNumber m=0;                           
-  unsigned int i,j,carry=0, carryn=0;
-  for(i=0;i<m_nLen;i++)  {
-    for(j=0;j<m_nLen;j++)  {
-      carryn = m.m_pDigits[j+i]+m_pDigits[i]*a.m_pDigits[j]+carry;
-      carryn = (carryn>=256 ? carryn/256 : 0);      
-      m.m_pDigits[j+i] += m_pDigits[i]*a.m_pDigits[j]+carry;
-      carry=carryn;
+  GroundNumber m;                           
+  for(unsigned int i=0;i<m_nLen;i++)  {
+    Limb carry=0;
+    for(unsigned int j=0;i+j<m_nLen;j++)  {
+      unsigned __int128 t = (unsigned __int128)m_pLimbs[i]*a.m_pLimbs[j] + m.m_pLimbs[i+j] + carry;
+      m.m_pLimbs[i+j] = (Limb)t;
+      carry = (Limb)(t >> 64);
     }
-    m.m_pDigits[j+i+1] += carry; 	 
   }    
   m.TruncateToSize();
   return m;
 }  
 
 
+GroundNumber GroundNumber::operator / (const GroundNumber &a) { 
+  GroundNumber q, r;
+  DivMod(a, q, r);
+  return q;
+}  
+
+
+GroundNumber GroundNumber::operator % (const GroundNumber &a) { 
+  GroundNumber q, r;
+  DivMod(a, q, r);
+  return r;
+}  
+
+
+void GroundNumber::DivMod(const GroundNumber &d, GroundNumber &q, GroundNumber &r) const { 
+  if(m_nLen==1) {
+    if(d.m_pLimbs[0]) {
+      q.m_pLimbs[0] = m_pLimbs[0]/d.m_pLimbs[0];
+      r.m_pLimbs[0] = m_pLimbs[0]%d.m_pLimbs[0];
+    }
+    else {
+      q.m_pLimbs[0] = ~(Limb)0;
+      q.TruncateToSize();
+      r = *this;
+    }
+    return;
+  }
+
+  unsigned int j;
+  for(j=0;j<m_nLen;j++) 
+    q.m_pLimbs[j] = r.m_pLimbs[j] = 0;
+
+  for(int k=iAbstractNumberLength-1;k>=0;k--) {
+    // r = 2r + (bit k of this); the bit shifted out counts as 2^size
+    bool top = r.Bit(iAbstractNumberLength-1);
+    Limb carry = Bit(k);
+    for(j=0;j<m_nLen;j++) { 
+      Limb carryn = (r.m_pLimbs[j]>>63);
+      r.m_pLimbs[j] = (r.m_pLimbs[j]<<1) | carry;
+      carry = carryn;
+    }
+    r.TruncateToSize();
+
+    if (top || !(r<d)) {
+      r = r - d;
+      q.m_pLimbs[k/64] |= ((Limb)1 << (k%64));
+    }
+  }
+}  
+
+
 GroundNumber GroundNumber::operator - (const GroundNumber &a) { 
   GroundNumber m;                           
-  unsigned int carryn, carry=0;
+  bool borrow=false;
   for(unsigned int i=0;i<m_nLen;i++)  {
-    carryn = (m_pDigits[i]<a.m_pDigits[i]+carry) ? 1 : 0; 
-    m.m_pDigits[i] = m_pDigits[i]-a.m_pDigits[i]-carry;
-    carry=carryn;
+    bool borrown = __builtin_sub_overflow(m_pLimbs[i], a.m_pLimbs[i], &m.m_pLimbs[i]);
+    borrown |= __builtin_sub_overflow(m.m_pLimbs[i], (Limb)borrow, &m.m_pLimbs[i]);
+    borrow=borrown;
   }
   m.TruncateToSize();
   return m;
@@ -271,7 +327,7 @@ GroundNumber GroundNumber::operator - (const GroundNumber &a) {
 GroundNumber GroundNumber::operator ^ (const GroundNumber &a) { 
   GroundNumber m;                           
   for(unsigned int i=0;i<m_nLen;i++)  
-    m.m_pDigits[i] = m_pDigits[i]^a.m_pDigits[i];
+    m.m_pLimbs[i] = m_pLimbs[i]^a.m_pLimbs[i];
   return m;
 }  
 
@@ -279,7 +335,7 @@ GroundNumber GroundNumber::operator ^ (const GroundNumber &a) {
 GroundNumber GroundNumber::operator | (const GroundNumber &a) { 
   GroundNumber m;                           
   for(unsigned int i=0;i<m_nLen;i++)  
-    m.m_pDigits[i] = m_pDigits[i]|a.m_pDigits[i];
+    m.m_pLimbs[i] = m_pLimbs[i]|a.m_pLimbs[i];
   return m;
 }  
 
@@ -287,16 +343,16 @@ GroundNumber GroundNumber::operator | (const GroundNumber &a) {
 GroundNumber GroundNumber::operator & (const GroundNumber &a) { 
   GroundNumber m;                           
   for(unsigned int i=0;i<m_nLen;i++)  
-    m.m_pDigits[i] = m_pDigits[i]&a.m_pDigits[i];
+    m.m_pLimbs[i] = m_pLimbs[i]&a.m_pLimbs[i];
   return m;
 }  
 
 
 bool GroundNumber::operator < (const GroundNumber &a) { 
    for(int i=m_nLen-1;i>=0;i--)  { 
-      if (m_pDigits[i]>a.m_pDigits[i]) 
+      if (m_pLimbs[i]>a.m_pLimbs[i]) 
          return false;
-      if (m_pDigits[i]<a.m_pDigits[i]) 
+      if (m_pLimbs[i]<a.m_pLimbs[i]) 
          return true;
    }
    return false;
@@ -310,9 +366,9 @@ bool GroundNumber::operator > (const GroundNumber &a) {
 
 bool GroundNumber::operator <= (const GroundNumber &a) { 
    for(int i=m_nLen-1;i>=0;i--)  { 
-      if (m_pDigits[i]>a.m_pDigits[i]) 
+      if (m_pLimbs[i]>a.m_pLimbs[i]) 
          return false;
-      if (m_pDigits[i]<a.m_pDigits[i]) 
+      if (m_pLimbs[i]<a.m_pLimbs[i]) 
          return true;
    }
    return true;
@@ -324,26 +380,35 @@ bool GroundNumber::operator >= (const GroundNumber &a) {
 
 bool GroundNumber::operator == (const GroundNumber &a) { 
    for(int i=m_nLen-1;i>=0;i--)  
-      if (m_pDigits[i]!=a.m_pDigits[i]) 
+      if (m_pLimbs[i]!=a.m_pLimbs[i]) 
          return false;
    return true;
 }
 
 
 bool GroundNumber::operator != (const GroundNumber &a) { 
-   for(int i=m_nLen-1;i>=0;i--)  
-      if (m_pDigits[i]!=a.m_pDigits[i]) 
+   return !(*this==a);
+}
+
+
+// two's complement: a negative number (the highest bit set) is less than
+// a non-negative one, numbers of the same sign compare as unsigned ones
+bool GroundNumber::LessSigned(const GroundNumber &a) const { 
+   bool s = Bit(iAbstractNumberLength-1), t = a.Bit(iAbstractNumberLength-1);
+   if (s != t) 
+      return s;
+   for(int i=m_nLen-1;i>=0;i--)  { 
+      if (m_pLimbs[i]>a.m_pLimbs[i]) 
+         return false;
+      if (m_pLimbs[i]<a.m_pLimbs[i]) 
          return true;
+   }
    return false;
 }
 
-unsigned int GroundNumber::GetGroundValueUnsigned() const { 
-   unsigned int s=0;
-   unsigned int l;
-   l = (sizeof(unsigned int)>m_nLen ? m_nLen : sizeof(unsigned int)); 
-   for(int i=l-1;i>=0;i--)  {
-     s = s*256+m_pDigits[i]; 
-   }
-   return s;	
+unsigned long GroundNumber::GetGroundValueUnsigned() const { 
+   for(unsigned int i=1;i<m_nLen;i++) 
+      if(m_pLimbs[i])
+         return ULONG_MAX;
+   return m_pLimbs[0];	
 }
-  
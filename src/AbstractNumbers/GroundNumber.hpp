@@ -17,19 +17,29 @@ GNU General Public License for more details.
 #define __GROUND_NUMBER_H
 
 
+#include <stdint.h>
+
 class Boolean;
 
+// The value is kept in 64-bit limbs, the least significant limb first. Up
+// to INLINE_LIMBS limbs (widths up to 128 bits) are stored in the object
+// itself, so temporaries need no heap memory; longer numbers allocate their
+// limbs.
+
 class GroundNumber { 
 friend class Boolean;
 
 public:
   GroundNumber();  
-  GroundNumber(unsigned int n);
+  GroundNumber(unsigned long n);
   GroundNumber(const GroundNumber& n);
   ~GroundNumber();
 
-  GroundNumber& operator = (GroundNumber n);
-  GroundNumber& operator = (unsigned int n); 
+  GroundNumber& operator = (const GroundNumber &n);
+  // a temporary of the same length swaps its limbs if they are on the
+  // heap, so both numbers keep a full-length value
+  GroundNumber& operator = (GroundNumber &&n);
+  GroundNumber& operator = (unsigned long n); 
   GroundNumber& operator = (char* s);
   GroundNumber negate() const;
   GroundNumber bitnegate() const;
@@ -37,6 +47,8 @@ public:
   GroundNumber operator << (const GroundNumber &n);
   GroundNumber operator >> (const GroundNumber &n);
   GroundNumber operator *  (const GroundNumber &n);
+  GroundNumber operator /  (const GroundNumber &n);
+  GroundNumber operator %  (const GroundNumber &n);
   GroundNumber operator +  (const GroundNumber &n);
   GroundNumber operator -  (const GroundNumber &n);
   GroundNumber operator ^  (const GroundNumber &n);
@@ -48,6 +60,7 @@ public:
   bool operator >= (const GroundNumber &n);  
   bool operator == (const GroundNumber &n);
   bool operator != (const GroundNumber &n);
+  bool LessSigned(const GroundNumber &n) const;
 
   bool Bit(unsigned int i) const;
   GroundNumber sgn() const;
@@ -56,12 +69,23 @@ public:
   void list() const;  
   void TruncateToSize();
 
-  unsigned char* GetGroundValue() const { return m_pDigits; }
-  unsigned int GetGroundValueUnsigned() const;
+  // the value, or the largest unsigned long if it does not fit
+  unsigned long GetGroundValueUnsigned() const;
+  // the amount of a shift by this number: the value, or the width if it
+  // is larger
+  unsigned int ShiftAmount() const;
 
 private: 
+  typedef uint64_t Limb;
+  enum { INLINE_LIMBS = 2 };
+
+  void Allocate(unsigned int len);
+  // restoring long division; x / 0 has all bits set and x % 0 is x
+  void DivMod(const GroundNumber &d, GroundNumber &q, GroundNumber &r) const;
+
   unsigned int m_nLen;
-  unsigned char* m_pDigits;
+  Limb* m_pLimbs;
+  Limb m_aInline[INLINE_LIMBS];
 };
 
 
@@ -17,10 +17,12 @@ GNU General Public License for more details.
 #include <FormulaVector.h>
 #include <Number.hpp>
 #include <Boolean.hpp>
+#include <utility>
 
 extern unsigned int iAbstractNumberLength;
 
 
+// a ground operand of a mixed operation is turned into a vector of constants
 #define DEF_OP(OPERATOR) \
    Number Number::operator OPERATOR (const Number &n) { \
      Number m((unsigned int)0);                           \
@@ -52,7 +54,39 @@ extern unsigned int iAbstractNumberLength;
      return m;                           \
    };
 
-#define DEF_REL_OP(REL_OPERATOR) \
+// a ground operand of a mixed operation is not turned into a vector of
+// constants, FormulaVector reads its bits directly; GROUND_ABSTRACT is
+// m_nN OPERATOR n.m_nW in terms of the operations with the ground operand
+// on the right
+#define DEF_CONST_OP(OPERATOR, GROUND_ABSTRACT) \
+   Number Number::operator OPERATOR (const Number &n) { \
+     Number m((unsigned int)0);                           \
+     if(IsGroundNumber())  {             \
+       if(n.IsGroundNumber())  {         \
+         m.m_nN = m_nN OPERATOR n.m_nN;  \
+         m.SetType(eGroundNumber);       \
+         m.TruncateToSize(iAbstractNumberLength); \
+       }                                 \
+       else  {                           \
+         m.m_nW = GROUND_ABSTRACT;       \
+         m.SetType(eAbstractNumber);     \
+       }                                 \
+     }                                   \
+     else  {                             \
+       if(n.IsGroundNumber()) {          \
+         m.m_nW = m_nW OPERATOR n.m_nN;  \
+         m.SetType(eAbstractNumber);     \
+       }                                 \
+       else {                            \
+         m.m_nW = m_nW OPERATOR n.m_nW;  \
+         m.SetType(eAbstractNumber);     \
+       }                                 \
+     }                                   \
+     return m;                           \
+   };
+
+// MIRROR_OPERATOR is REL_OPERATOR with the operands swapped
+#define DEF_REL_OP(REL_OPERATOR, MIRROR_OPERATOR) \
    Boolean Number::operator REL_OPERATOR (const Number &n) { \
      Boolean b(false);                   \
      if(IsGroundNumber())  {             \
@@ -61,17 +95,13 @@ extern unsigned int iAbstractNumberLength;
          b.SetType(eGroundBoolean);      \
        }                                 \
        else  {                           \
-         AbstractNumber w;               \
-         w = m_nN;                       \
-         b.m_bW = w REL_OPERATOR n.m_nW; \
+         b.m_bW = n.m_nW MIRROR_OPERATOR m_nN; \
          b.SetType(eAbstractBoolean);    \
        }                                 \
      }                                   \
      else  {                             \
-         if(n.IsGroundNumber()) {        \
-         AbstractNumber w;               \
-         w = n.m_nN;\
-         b.m_bW = m_nW REL_OPERATOR w;   \
+       if(n.IsGroundNumber()) {          \
+         b.m_bW = m_nW REL_OPERATOR n.m_nN;  \
          b.SetType(eAbstractBoolean);    \
        }                                 \
        else {                            \
@@ -83,15 +113,23 @@ extern unsigned int iAbstractNumberLength;
    };
 
 
-  Number::Number(unsigned int* iVarCounter) { 
+  Number::Number(unsigned int* iVarCounter) : Number(iVarCounter, iAbstractNumberLength, false) {}
+
+  Number::Number(unsigned int* iVarCounter, unsigned int nWidth, bool bSigned) { 
     m_nID= *iVarCounter; 
-    m_nW.initDefined(*iVarCounter); 
-    *iVarCounter += iAbstractNumberLength;
+    m_nWidth = nWidth;
+    m_bSigned = bSigned;
+    m_nW.initDefined(*iVarCounter, nWidth, bSigned); 
+    *iVarCounter += nWidth;
     SetType(eAbstractNumber); 
   }
   
-  Number::Number(unsigned int n) { 
+  Number::Number(unsigned int n) : Number((unsigned long)n) {}
+
+  Number::Number(unsigned long n) { 
     m_nID=-1;
+    m_nWidth=iAbstractNumberLength;
+    m_bSigned=false;
     m_nN = n;
     SetType(eGroundNumber);
     TruncateToSize(iAbstractNumberLength);  
@@ -99,6 +137,8 @@ extern unsigned int iAbstractNumberLength;
 
   Number::Number(char *s) { 
     m_nID=-1;
+    m_nWidth=iAbstractNumberLength;
+    m_bSigned=false;
     m_nN = s;
     SetType(eGroundNumber);
     TruncateToSize(iAbstractNumberLength);  
@@ -114,19 +154,40 @@ cout << " ovde " << endl;
   }  
 */
 
-  Number::Number(const Number& n) { 
-    m_nN     =n.m_nN; 
-    m_nW     =n.m_nW; 
+  Number::Number(const Number& n) : m_nN(n.m_nN), m_nW(n.m_nW) { 
     m_nID    =n.m_nID;
+    m_nWidth =n.m_nWidth;
+    m_bSigned=n.m_bSigned;
+    m_VarType=n.m_VarType;
+  }    
+
+  // the results of the operations are moved, so their formulas are not
+  // reference counted once more on the way to a variable
+  Number::Number(Number&& n) : m_nN(std::move(n.m_nN)), m_nW(std::move(n.m_nW)) { 
+    m_nID    =n.m_nID;
+    m_nWidth =n.m_nWidth;
+    m_bSigned=n.m_bSigned;
     m_VarType=n.m_VarType;
   }    
 
   Number::~Number() {}
 
-  Number& Number::operator = (Number n) { 
+  Number& Number::operator = (const Number& n) { 
     m_nN     =n.m_nN; 
     m_nW     =n.m_nW; 
     m_nID    =n.m_nID;
+    m_nWidth =n.m_nWidth;
+    m_bSigned=n.m_bSigned;
+    m_VarType=n.m_VarType;
+    return *this;
+  }
+
+  Number& Number::operator = (Number&& n) { 
+    m_nN     =std::move(n.m_nN); 
+    m_nW     =std::move(n.m_nW); 
+    m_nID    =n.m_nID;
+    m_nWidth =n.m_nWidth;
+    m_bSigned=n.m_bSigned;
     m_VarType=n.m_VarType;
     return *this;
   }
@@ -179,13 +240,22 @@ cout << " OVDE " << endl;
 
   Number Number::operator << (const Number &n) { 
     Number m((unsigned int)0);                           
-    //assert(n.IsGroundNumber());
-    if(IsGroundNumber())  {             
+    if(!n.IsGroundNumber())  {
+      // abstract shift amount: barrel shifter
+      AbstractNumber w;
+      if(IsGroundNumber())
+        w = m_nN;
+      else
+        w = m_nW;
+      m.m_nW = (w << n.m_nW);
+      m.SetType(eAbstractNumber);
+    }
+    else if(IsGroundNumber())  {             
       m.m_nN = (m_nN << n.m_nN);  
       m.SetType(eGroundNumber);       
     }                                   
     else  {                             
-      m.m_nW = (m_nW << n.m_nN.GetGroundValueUnsigned());       
+      m.m_nW = (m_nW << n.m_nN.ShiftAmount());       
       m.SetType(eAbstractNumber);     
     }                                   
     return m;                           
@@ -194,34 +264,71 @@ cout << " OVDE " << endl;
 
   Number Number::operator >> (const Number &n) { 
     Number m((unsigned int)0);                           
-    //assert(n.IsGroundNumber());
-    if(IsGroundNumber())  {             
+    if(!n.IsGroundNumber())  {
+      // abstract shift amount: barrel shifter
+      AbstractNumber w;
+      if(IsGroundNumber())
+        w = m_nN;
+      else
+        w = m_nW;
+      m.m_nW = (w >> n.m_nW);
+      m.SetType(eAbstractNumber);
+    }
+    else if(IsGroundNumber())  {             
       m.m_nN = (m_nN >> n.m_nN);  
       m.SetType(eGroundNumber);       
     }                                   
     else  {                             
-      m.m_nW = (m_nW >> n.m_nN.GetGroundValueUnsigned());       
+      m.m_nW = (m_nW >> n.m_nN.ShiftAmount());       
       m.SetType(eAbstractNumber);     
     }                                   
     return m;                           
   }
 
 
-  DEF_OP(*)
-  DEF_OP(+)
-  DEF_OP(-)
-  DEF_OP(^)
-  DEF_OP(|)
-  DEF_OP(&)
+  DEF_CONST_OP(*, n.m_nW * m_nN)
+  DEF_CONST_OP(+, n.m_nW + m_nN)
+  DEF_CONST_OP(-, n.m_nW.subtractFrom(m_nN))
+  DEF_CONST_OP(^, n.m_nW ^ m_nN)
+  DEF_CONST_OP(|, n.m_nW | m_nN)
+  DEF_CONST_OP(&, n.m_nW & m_nN)
+  DEF_OP(/)
+  DEF_OP(%)
 
-//  DEF_OP(/)
+  DEF_REL_OP(<, >)
+  DEF_REL_OP(>, <)
+  DEF_REL_OP(<=, >=)
+  DEF_REL_OP(>=, <=)
+  DEF_REL_OP(==, ==)
+  DEF_REL_OP(!=, !=)
 
-  DEF_REL_OP(<)
-  DEF_REL_OP(>)
-  DEF_REL_OP(<=)
-  DEF_REL_OP(>=)
-  DEF_REL_OP(==)
-  DEF_REL_OP(!=)
+
+  // the signed (two's complement) comparison; the other signed relations
+  // are this one with the operands swapped or negated
+  Boolean Number::LessSigned(const Number &n) {
+     Boolean b(false);
+     if(IsGroundNumber())  {
+       if(n.IsGroundNumber())  {
+         b.m_bB = m_nN.LessSigned(n.m_nN);
+         b.SetType(eGroundBoolean);
+       }
+       else  {
+         b.m_bW = n.m_nW.greaterSigned(m_nN);
+         b.SetType(eAbstractBoolean);
+       }
+     }
+     else  {
+       if(n.IsGroundNumber()) {
+         b.m_bW = m_nW.lessSigned(n.m_nN);
+         b.SetType(eAbstractBoolean);
+       }
+       else {
+         b.m_bW = m_nW.lessSigned(n.m_nW);
+         b.SetType(eAbstractBoolean);
+       }
+     }
+     return b;
+  }
 
 
   Number Number::ite(const Boolean &b, const Number &n2) {
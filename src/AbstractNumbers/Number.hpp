@@ -31,12 +31,16 @@ friend class Boolean;
 public:
   Number(char *s);  
   Number(unsigned int* iVarCounter);
+  Number(unsigned int* iVarCounter, unsigned int nWidth, bool bSigned);
   Number(unsigned int n);
+  Number(unsigned long n);
   Number(GroundNumber n);
   Number(const Number& n);
+  Number(Number&& n);
   ~Number();
 
-  Number& operator = (Number n);
+  Number& operator = (const Number& n);
+  Number& operator = (Number&& n);
  /* Number& operator = (GroundNumber n);*/
   void SetConstraint(unsigned int n);
   Number negate() const;
@@ -45,6 +49,8 @@ public:
   Number operator << (const Number &n);
   Number operator >> (const Number &n);
   Number operator *  (const Number &n);
+  Number operator /  (const Number &n);
+  Number operator %  (const Number &n);
   Number operator +  (const Number &n);
   Number operator -  (const Number &n);
   Number operator ^  (const Number &n);
@@ -56,6 +62,7 @@ public:
   Boolean operator >= (const Number &n);  
   Boolean operator == (const Number &n);
   Boolean operator != (const Number &n);
+  Boolean LessSigned(const Number &n);
 
   Number ite(const Boolean &b, const Number &n2);
   Number sgn();
@@ -72,12 +79,15 @@ public:
   unsigned int GetID() const { return m_nID; }
   bool IsIndependent() const { return (m_nID!=-1); }
   void SetIsDependent() { m_nID=-1; }
+  /* the number of variables of an independent number and their extension */
+  unsigned int GetWidth() const { return m_nWidth; }
+  bool IsSigned() const { return m_bSigned; }
 
-  GroundNumber GetGroundValue() const { return m_nN; }
-  unsigned int GetGroundValueUnsigned() const { 
+  const GroundNumber& GetGroundValue() const { return m_nN; }
+  unsigned long GetGroundValueUnsigned() const { 
      return m_nN.GetGroundValueUnsigned();
   }
-  AbstractNumber GetAbstractValue() const { return m_nW; }
+  const AbstractNumber& GetAbstractValue() const { return m_nW; }
 
   void SetAccessed(bool b) { bAccessed=b; }
   bool GetAccessed() const { return bAccessed; }
@@ -87,6 +97,8 @@ private:
   GroundNumber m_nN;
   AbstractNumber m_nW;
   int m_nID;
+  unsigned int m_nWidth;
+  bool m_bSigned;
   eVarType m_VarType;
 
   bool bAccessed; /* for dealing with arguments of procedures that are not used */
@@ -0,0 +1,942 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010-2020, Predrag Janicic
+
+This file is part of URSA
+
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#include <iostream>
+#include "URSA_SATinterpreter.hpp"
+#include "ursa.tab.hpp"
+
+using namespace std;
+
+extern unsigned int iVarCounter;
+extern unsigned int iAbstractNumberLength;
+
+
+// the code of each command is compiled when the command is first executed
+// and kept for the later executions (of loops, procedures and of the whole
+// program for optimization problems); the code of the commands cleared
+// while some code runs is deleted when no code runs (the interpreter can
+// clear its program when it is destroyed, so the map is never destroyed)
+static map<nodeType *, Bytecode *>& CompiledCommands() {
+    static map<nodeType *, Bytecode *> *pCompiled = new map<nodeType *, Bytecode *>;
+    return *pCompiled;
+}
+static vector<Bytecode *> ClearedCommands;
+static unsigned int nRunning = 0;
+
+
+// the elements of a that are not in b
+static set<unsigned int> Minus(const set<unsigned int>& a, const set<unsigned int>& b) {
+    set<unsigned int> r;
+    for (set<unsigned int>::const_iterator it = a.begin(); it != a.end(); it++)
+      if (b.count(*it) == 0)
+        r.insert(*it);
+    return r;
+}
+
+
+// a = a /\ b
+static void Intersect(set<unsigned int>& a, const set<unsigned int>& b) {
+    a = Minus(a, Minus(a, b));
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+int Interpreter::Execute(nodeType *p) {
+    Bytecode *code;
+    map<nodeType *, Bytecode *>::iterator it = CompiledCommands().find(p);
+    if (it != CompiledCommands().end())
+      code = it->second;
+    else {
+      code = Compile(p, true);
+      CompiledCommands()[p] = code;
+    }
+
+    nRunning++;
+    if (!Run(*code)) {
+      if (code->pGeneric == NULL)
+        code->pGeneric = Compile(p, false);
+      Run(*code->pGeneric);
+    }
+    if (--nRunning == 0) {
+      for (unsigned int i = 0; i < ClearedCommands.size(); i++)
+        delete ClearedCommands[i];
+      ClearedCommands.clear();
+    }
+    return 0;
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// the code of the command p, with the number variables that are currently
+// ground as its inputs if bInputs is set
+Bytecode *Interpreter::Compile(nodeType *p, bool bInputs) {
+    Bytecode *code = new Bytecode;
+    set<unsigned int> vars, ground;
+    unsigned long n;
+
+    if (bInputs && iAbstractNumberLength <= 64) {
+      NumberVars(p, vars);
+      for (set<unsigned int>::iterator it = vars.begin(); it != vars.end(); it++)
+        if (m_ST.getGroundIntValue(*it, n)) {
+          code->inputs.push_back(*it);
+          code->Slot(*it);
+          ground.insert(*it);
+        }
+    }
+    CompileCommand(p, *code, ground);
+    Spill(ground, *code);
+    return code;
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// the number variables in p
+void Interpreter::NumberVars(nodeType *p, set<unsigned int>& vars) {
+    if (!p)
+      return;
+    if (p->type == typeId && IsNumberId(p))
+      vars.insert(p->id.n);
+    if (p->type == typeOpr)
+      for (int i = 0; i < p->opr.nops; i++)
+        NumberVars(p->opr.op[i], vars);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+void Interpreter::ForgetCommand(nodeType *p) {
+    map<nodeType *, Bytecode *>::iterator it = CompiledCommands().find(p);
+    if (it != CompiledCommands().end()) {
+      if (nRunning)
+        ClearedCommands.push_back(it->second);
+      else
+        delete it->second;
+      CompiledCommands().erase(it);
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// Whether the expression p is ground whenever it is evaluated with the
+// variables in ground having ground values. Array elements, cardinality
+// constraints and all numbers longer than 64 bits are treated as abstract.
+
+bool Interpreter::IsGround(nodeType *p, const set<unsigned int>& ground) {
+    if (!p || iAbstractNumberLength > 64)
+      return false;
+
+    switch(p->type) {
+    case typeIntConst:
+    case typeBoolConst: return true;
+    case typeId:        return ground.count(p->id.n) > 0;
+    case typeOpr:
+        switch(p->opr.oper) {
+        case UMINUS:    case '~':       case SGN:
+        case '+':       case '-':       case '*':       case '/':
+        case '%':       case '&':       case '|':       case '^':
+        case LSHIFT:    case RSHIFT:    case ITE:       case BOOL2NUM:
+        case LOGICALAND:case LOGICALOR: case LOGICALXOR:case '!':
+        case '<':       case '>':       case LE:        case GE:
+        case EQ:        case NE:        case SLT:       case SGT:
+        case SLE:       case SGE:       case NUM2BOOL:
+                        for (int i = 0; i < p->opr.nops; i++)
+                          if (!IsGround(p->opr.op[i], ground))
+                            return false;
+                        return true;
+        default:        return false;
+        }
+    default: return false;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// The ground variables after the command p, given those before it. This
+// follows the decisions of CompileCommand, without emitting code.
+
+void Interpreter::GroundAfter(nodeType *p, set<unsigned int>& ground) {
+    if (!p || p->type != typeOpr)
+      return;
+
+    switch(p->opr.oper) {
+      case FOR:       GroundAfter(p->opr.op[0], ground);
+                      LoopHead(p->opr.op[3], p->opr.op[2], ground);
+                      return;
+
+      case WHILE:     LoopHead(p->opr.op[1], NULL, ground);
+                      return;
+
+      case IF:      { set<unsigned int> els = ground;
+                      GroundAfter(p->opr.op[1], ground);
+                      if (p->opr.nops > 2)
+                        GroundAfter(p->opr.op[2], els);
+                      Intersect(ground, els);
+                      return; }
+
+      case ';':       GroundAfter(p->opr.op[0], ground);
+                      GroundAfter(p->opr.op[1], ground);
+                      return;
+
+      case '=':       if (p->opr.nops == 2 && IsNumberId(p->opr.op[0])) {
+                        if (IsGround(p->opr.op[1], ground))
+                          ground.insert(p->opr.op[0]->id.n);
+                        else
+                          ground.erase(p->opr.op[0]->id.n);
+                      }
+                      return;
+
+      case PLUSEQ:
+      case MINUSEQ:
+      case MULTEQ:
+      case DIVEQ:
+      case MODEQ:
+      case BITWISEANDEQ:
+      case BITWISEOREQ:
+      case BITWISEXOREQ:
+      case LSHIFTEQ:
+      case RSHIFTEQ:  if (p->opr.nops == 2 && !IsGround(p->opr.op[1], ground))
+                        ground.erase(p->opr.op[0]->id.n);
+                      return;
+
+      case PLUSPLUS:
+      case MINUSMINUS:
+      case ANDEQ:
+      case OREQ:
+      case XOREQ:
+      // these commands do not change the number variables
+      case PRINT:
+      case PRINTX:
+      case PRINTB:
+      case LIST:
+      case WIDTH:
+      case SWIDTH:    return;
+
+      default:        ground.clear();
+                      return;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// The ground variables at the head of a loop: those that are ground when
+// the loop is entered and after each iteration of the body and the step.
+
+void Interpreter::LoopHead(nodeType *body, nodeType *step, set<unsigned int>& ground) {
+    set<unsigned int> after;
+    unsigned int n;
+    do {
+      n = ground.size();
+      after = ground;
+      GroundAfter(body, after);
+      GroundAfter(step, after);
+      Intersect(ground, after);
+    } while (ground.size() != n);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// writes the native values of the given variables to the symbol table
+void Interpreter::Spill(const set<unsigned int>& vars, Bytecode& c) {
+    for (set<unsigned int>::const_iterator it = vars.begin(); it != vars.end(); it++)
+      c.Emit(opGSpill, *it, c.Slot(*it));
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+Operand Interpreter::GroundConstant(unsigned long n, Bytecode& c) {
+    Operand r = c.New(rfGround);
+    c.groundConstants.push_back(n);
+    c.Emit(opGConst, r.r, c.groundConstants.size()-1);
+    return r;
+}
+
+
+Operand Interpreter::ToNumber(Operand o, Bytecode& c) {
+    if (o.file != rfGround)
+      return o;
+    c.Free(o);
+    Operand r = c.New(rfNumber);
+    c.Emit(opG2N, r.r, o.r);
+    return r;
+}
+
+
+Operand Interpreter::ToBoolean(Operand o, Bytecode& c) {
+    if (o.file != rfGround)
+      return o;
+    c.Free(o);
+    Operand r = c.New(rfBoolean);
+    c.Emit(opG2B, r.r, o.r);
+    return r;
+}
+
+
+Operand Interpreter::ToIndex(Operand o, Bytecode& c) {
+    if (o.file == rfGround)
+      return o;
+    c.Free(o);
+    Operand r = c.New(rfGround);
+    c.Emit(opN2G, r.r, o.r);
+    return r;
+}
+
+
+// the operation op on the values of a and b, or gop if both are ground
+Operand Interpreter::Binary(eOpcode op, eOpcode gop, eRegisterFile operands, eRegisterFile result, Operand a, Operand b, Bytecode& c) {
+    Operand r;
+    if (a.file == rfGround && b.file == rfGround)
+      result = rfGround;
+    else if (operands == rfNumber) {
+      a = ToNumber(a, c);
+      b = ToNumber(b, c);
+    }
+    else {
+      a = ToBoolean(a, c);
+      b = ToBoolean(b, c);
+    }
+    c.Free(a);
+    c.Free(b);
+    r = c.New(result);
+    c.Emit(result == rfGround ? gop : op, r.r, a.r, b.r);
+    return r;
+}
+
+
+// the operation op on the value of a, or gop if it is ground
+Operand Interpreter::Unary(eOpcode op, eOpcode gop, eRegisterFile result, Operand a, Bytecode& c) {
+    Operand r;
+    c.Free(a);
+    r = c.New(a.file == rfGround ? rfGround : result);
+    c.Emit(a.file == rfGround ? gop : op, r.r, a.r);
+    return r;
+}
+
+
+// the jump over the code that follows if the condition r is false
+unsigned int Interpreter::JumpIfNot(Operand r, Bytecode& c) {
+    c.Free(r);
+    return c.Emit(r.file == rfGround ? opGJumpIfNot : opJumpIfNot, 0, r.r);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// The operands are compiled in the order in which the tree-walking
+// interpreter reads them (e.g., the right operand of + first), so the
+// variables that are first read in an expression get the same numbers.
+// The set ground holds the number variables kept in native slots at the
+// current point of the command.
+
+void Interpreter::CompileCommand(nodeType *p, Bytecode& c, set<unsigned int>& ground) {
+    Operand i = { rfGround, 0 }, j = i, v = i, r = i;
+    unsigned int jump, exit;
+    set<unsigned int> head;
+
+    if (!p || p->type != typeOpr)
+      return;
+
+    switch(p->opr.oper) {
+      case FOR:       CompileCommand(p->opr.op[0], c, ground);
+                      head = ground;
+                      LoopHead(p->opr.op[3], p->opr.op[2], head);
+                      Spill(Minus(ground, head), c);
+                      ground = head;
+                      jump = c.code.size();
+                      exit = JumpIfNot(CompileBoolean(p->opr.op[1], c, ground), c);
+                      CompileCommand(p->opr.op[3], c, ground);
+                      CompileCommand(p->opr.op[2], c, ground);
+                      Spill(Minus(ground, head), c);
+                      c.Emit(opJump, jump);
+                      c.code[exit].a = c.code.size();
+                      ground = head;
+                      return;
+
+      case WHILE:     head = ground;
+                      LoopHead(p->opr.op[1], NULL, head);
+                      Spill(Minus(ground, head), c);
+                      ground = head;
+                      jump = c.code.size();
+                      exit = JumpIfNot(CompileBoolean(p->opr.op[0], c, ground), c);
+                      CompileCommand(p->opr.op[1], c, ground);
+                      Spill(Minus(ground, head), c);
+                      c.Emit(opJump, jump);
+                      c.code[exit].a = c.code.size();
+                      ground = head;
+                      return;
+
+      case IF:      { set<unsigned int> then = ground, els = ground;
+                      r = CompileBoolean(p->opr.op[0], c, ground);
+                      // the variables that are ground after the if; the
+                      // others are written to the symbol table before it
+                      // or at the end of the branch
+                      head = ground;
+                      GroundAfter(p->opr.op[1], head);
+                      if (p->opr.nops > 2)
+                        GroundAfter(p->opr.op[2], els);
+                      Intersect(head, els);
+                      els = ground;
+                      Spill(Minus(ground, head), c);
+                      exit = JumpIfNot(r, c);
+                      CompileCommand(p->opr.op[1], c, then);
+                      Spill(Minus(then, head), c);
+                      if (p->opr.nops > 2) {
+                        jump = c.Emit(opJump, 0);
+                        c.code[exit].a = c.code.size();
+                        CompileCommand(p->opr.op[2], c, els);
+                        Spill(Minus(els, head), c);
+                        c.code[jump].a = c.code.size();
+                      }
+                      else
+                        c.code[exit].a = c.code.size();
+                      ground = head;
+                      return; }
+
+      case ';':       CompileCommand(p->opr.op[0], c, ground);
+                      CompileCommand(p->opr.op[1], c, ground);
+                      return;
+
+      case '=':       if (IsNumberId(p->opr.op[0])) {
+                        v = CompileNumber(p->opr.op[p->opr.nops-1], c, ground);
+                        if (p->opr.nops == 2) {
+                          c.Free(v);
+                          if (v.file == rfGround) {
+                            c.Emit(opGStore, c.Slot(p->opr.op[0]->id.n), v.r);
+                            ground.insert(p->opr.op[0]->id.n);
+                          }
+                          else {
+                            c.Emit(opLetN, p->opr.op[0]->id.n, v.r);
+                            ground.erase(p->opr.op[0]->id.n);
+                          }
+                          return;
+                        }
+                        v = ToNumber(v, c);
+                        if (p->opr.nops == 3) {
+                          i = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Emit(opLetNEl, p->opr.op[0]->id.n, i.r, v.r);
+                        }
+                        else {
+                          j = ToIndex(CompileNumber(p->opr.op[2], c, ground), c);
+                          i = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Emit(opLetNEl2, p->opr.op[0]->id.n, i.r, j.r, v.r);
+                          c.Free(j);
+                        }
+                        c.Free(i);
+                        c.Free(v);
+                      }
+                      else {
+                        v = ToBoolean(CompileBoolean(p->opr.op[p->opr.nops-1], c, ground), c);
+                        if (p->opr.nops == 2)
+                          c.Emit(opLetB, p->opr.op[0]->id.n, v.r);
+                        else if (p->opr.nops == 3) {
+                          i = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Emit(opLetBEl, p->opr.op[0]->id.n, i.r, v.r);
+                          c.Free(i);
+                        }
+                        else {
+                          j = ToIndex(CompileNumber(p->opr.op[2], c, ground), c);
+                          i = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Emit(opLetBEl2, p->opr.op[0]->id.n, i.r, j.r, v.r);
+                          c.Free(i);
+                          c.Free(j);
+                        }
+                        c.Free(v);
+                      }
+                      return;
+
+      case PLUSPLUS:
+      case MINUSMINUS:
+      case PLUSEQ:
+      case MINUSEQ:
+      case MULTEQ:
+      case DIVEQ:
+      case MODEQ:
+      case BITWISEANDEQ:
+      case BITWISEOREQ:
+      case BITWISEXOREQ:
+      case LSHIFTEQ:
+      case RSHIFTEQ:
+                   {
+                      bool bIncrement = (p->opr.oper == PLUSPLUS || p->opr.oper == MINUSMINUS);
+                      unsigned int nVarId = p->opr.op[0]->id.n;
+                      unsigned int nIndices = p->opr.nops - (bIncrement ? 1 : 2);
+                      eOpcode op = opAdd, gop = opGAdd;
+                      switch(p->opr.oper) {
+                        case PLUSPLUS:
+                        case PLUSEQ:   op = opAdd; gop = opGAdd; break;
+                        case MINUSMINUS:
+                        case MINUSEQ:  op = opSub; gop = opGSub; break;
+                        case MULTEQ:   op = opMul; gop = opGMul; break;
+                        case DIVEQ:    op = opDiv; gop = opGDiv; break;
+                        case MODEQ:    op = opMod; gop = opGMod; break;
+                        case BITWISEANDEQ:  op = opAnd; gop = opGAnd; break;
+                        case BITWISEOREQ:   op = opOr; gop = opGOr; break;
+                        case BITWISEXOREQ:  op = opXor; gop = opGXor; break;
+                        case LSHIFTEQ: op = opShl; gop = opGShl; break;
+                        case RSHIFTEQ: op = opShr; gop = opGShr; break;
+                      }
+
+                      // a ground variable
+                      if (nIndices == 0 && ground.count(nVarId)) {
+                        r = c.New(rfGround);
+                        c.Emit(opGLoad, r.r, c.Slot(nVarId));
+                        v = (bIncrement ? GroundConstant(1, c) : CompileNumber(p->opr.op[1], c, ground));
+                        if (v.file == rfGround) {
+                          c.Emit(gop, r.r, r.r, v.r);
+                          c.Emit(opGStore, c.Slot(nVarId), r.r);
+                          c.Free(v);
+                          c.Free(r);
+                        }
+                        else {
+                          // the value becomes abstract
+                          r = ToNumber(r, c);
+                          c.Emit(op, r.r, r.r, v.r);
+                          c.Emit(opLetN, nVarId, r.r);
+                          c.Free(r);
+                          c.Free(v);
+                          ground.erase(nVarId);
+                        }
+                        return;
+                      }
+
+                      // the indices are read once, they cannot change before
+                      // the assignment
+                      if (nIndices == 2)
+                        j = ToIndex(CompileNumber(p->opr.op[2], c, ground), c);
+                      if (nIndices >= 1)
+                        i = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                      r = c.New(rfNumber);
+                      if (nIndices == 0)
+                        c.Emit(opNVar, r.r, nVarId);
+                      else if (nIndices == 1)
+                        c.Emit(opNEl, r.r, nVarId, i.r);
+                      else
+                        c.Emit(opNEl2, r.r, nVarId, i.r, j.r);
+
+                      if (bIncrement) {
+                        v = c.New(rfNumber);
+                        c.constants.push_back(Number((unsigned int)1));
+                        c.Emit(opNConst, v.r, c.constants.size()-1);
+                      }
+                      else
+                        v = ToNumber(CompileNumber(p->opr.op[p->opr.nops-1], c, ground), c);
+                      c.Emit(op, r.r, r.r, v.r);
+
+                      if (nIndices == 0)
+                        c.Emit(opLetN, nVarId, r.r);
+                      else if (nIndices == 1)
+                        c.Emit(opLetNEl, nVarId, i.r, r.r);
+                      else
+                        c.Emit(opLetNEl2, nVarId, i.r, j.r, r.r);
+                      c.Free(v);
+                      c.Free(r);
+                      if (nIndices >= 1)
+                        c.Free(i);
+                      if (nIndices == 2)
+                        c.Free(j);
+                      return;
+                   }
+
+      case ANDEQ:
+      case OREQ:
+      case XOREQ:
+                   {
+                      unsigned int nVarId = p->opr.op[0]->id.n;
+                      unsigned int nIndices = p->opr.nops - 2;
+                      if (nIndices == 2)
+                        j = ToIndex(CompileNumber(p->opr.op[2], c, ground), c);
+                      if (nIndices >= 1)
+                        i = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                      r = c.New(rfBoolean);
+                      if (nIndices == 0)
+                        c.Emit(opBVar, r.r, nVarId);
+                      else if (nIndices == 1)
+                        c.Emit(opBEl, r.r, nVarId, i.r);
+                      else
+                        c.Emit(opBEl2, r.r, nVarId, i.r, j.r);
+
+                      v = ToBoolean(CompileBoolean(p->opr.op[p->opr.nops-1], c, ground), c);
+                      c.Emit(p->opr.oper == ANDEQ ? opLAnd : p->opr.oper == OREQ ? opLOr : opLXor, r.r, r.r, v.r);
+
+                      if (nIndices == 0)
+                        c.Emit(opLetB, nVarId, r.r);
+                      else if (nIndices == 1)
+                        c.Emit(opLetBEl, nVarId, i.r, r.r);
+                      else
+                        c.Emit(opLetBEl2, nVarId, i.r, j.r, r.r);
+                      c.Free(v);
+                      c.Free(r);
+                      if (nIndices >= 1)
+                        c.Free(i);
+                      if (nIndices == 2)
+                        c.Free(j);
+                      return;
+                   }
+
+      default:        // the tree-walking interpreter reads the symbol table
+                      Spill(ground, c);
+                      c.Emit(opExecute, 0, 0, 0, 0, p);
+                      GroundAfter(p, ground);
+                      return;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+Operand Interpreter::CompileNumber(nodeType *p, Bytecode& c, const set<unsigned int>& ground) {
+    Operand a, b, d, r;
+    eOpcode op = opAdd, gop = opGAdd;
+
+    if (p)
+    switch(p->type) {
+    case typeIntConst:  if (IsGround(p, ground)) {
+                          GroundNumber n;
+                          n = p->intConst.value;
+                          return GroundConstant(n.GetGroundValueUnsigned(), c);
+                        }
+                        r = c.New(rfNumber);
+                        c.constants.push_back(Number(p->intConst.value));
+                        c.Emit(opNConst, r.r, c.constants.size()-1);
+                        return r;
+
+    case typeId:        if (IsGround(p, ground)) {
+                          r = c.New(rfGround);
+                          c.Emit(opGLoad, r.r, c.Slot(p->id.n));
+                        }
+                        else {
+                          r = c.New(rfNumber);
+                          c.Emit(opNVar, r.r, p->id.n);
+                        }
+                        return r;
+
+    case typeOpr:
+        switch(p->opr.oper) {
+        case '@':       if(p->opr.nops==2) {
+                          a = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Free(a);
+                          r = c.New(rfNumber);
+                          c.Emit(opNEl, r.r, p->opr.op[0]->id.n, a.r);
+                        }
+                        else {
+                          b = ToIndex(CompileNumber(p->opr.op[2], c, ground), c);
+                          a = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Free(a);
+                          c.Free(b);
+                          r = c.New(rfNumber);
+                          c.Emit(opNEl2, r.r, p->opr.op[0]->id.n, a.r, b.r);
+                        }
+                        return r;
+
+        case UMINUS:    return Unary(opNeg, opGNeg, rfNumber, CompileNumber(p->opr.op[0], c, ground), c);
+        case '~':       return Unary(opBitNot, opGBitNot, rfNumber, CompileNumber(p->opr.op[0], c, ground), c);
+        case SGN:       return Unary(opSgn, opGSgn, rfNumber, CompileNumber(p->opr.op[0], c, ground), c);
+
+        case '+':       op = opAdd; gop = opGAdd; goto binary;
+        case '-':       op = opSub; gop = opGSub; goto binary;
+        case '*':       op = opMul; gop = opGMul; goto binary;
+        case '/':       op = opDiv; gop = opGDiv; goto binary;
+        case '%':       op = opMod; gop = opGMod; goto binary;
+        case '&':       op = opAnd; gop = opGAnd; goto binary;
+        case '|':       op = opOr; gop = opGOr; goto binary;
+        case '^':       op = opXor; gop = opGXor;
+        binary:         b = CompileNumber(p->opr.op[1], c, ground);
+                        a = CompileNumber(p->opr.op[0], c, ground);
+                        return Binary(op, gop, rfNumber, rfNumber, a, b, c);
+
+        case LSHIFT:
+        case RSHIFT:    a = CompileNumber(p->opr.op[0], c, ground);
+                        b = CompileNumber(p->opr.op[1], c, ground);
+                        if (p->opr.oper == LSHIFT)
+                          return Binary(opShl, opGShl, rfNumber, rfNumber, a, b, c);
+                        return Binary(opShr, opGShr, rfNumber, rfNumber, a, b, c);
+
+        case ITE:       a = CompileNumber(p->opr.op[1], c, ground);
+                        b = CompileNumber(p->opr.op[2], c, ground);
+                        d = CompileBoolean(p->opr.op[0], c, ground);
+                        if (a.file == rfGround && b.file == rfGround && d.file == rfGround) {
+                          c.Free(a);
+                          c.Free(b);
+                          c.Free(d);
+                          r = c.New(rfGround);
+                          c.Emit(opGIte, r.r, a.r, b.r, d.r);
+                          return r;
+                        }
+                        a = ToNumber(a, c);
+                        b = ToNumber(b, c);
+                        d = ToBoolean(d, c);
+                        c.Free(a);
+                        c.Free(b);
+                        c.Free(d);
+                        r = c.New(rfNumber);
+                        c.Emit(opNIte, r.r, a.r, b.r, d.r);
+                        return r;
+
+        case BOOL2NUM:  a = CompileBoolean(p->opr.op[0], c, ground);
+                        // a ground boolean is 0 or 1
+                        if (a.file == rfGround)
+                          return a;
+                        return Unary(opBool2Num, opBool2Num, rfNumber, a, c);
+        }
+    default: break;
+    }
+
+    r = c.New(rfNumber);
+    c.constants.push_back(Number((unsigned int)0));
+    c.Emit(opNConst, r.r, c.constants.size()-1);
+    return r;
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+Operand Interpreter::CompileBoolean(nodeType *p, Bytecode& c, const set<unsigned int>& ground) {
+    Operand a, b, d, r;
+    eOpcode op = opLAnd, gop = opGLAnd;
+
+    if (p)
+    switch(p->type) {
+    case typeBoolConst: if (IsGround(p, ground))
+                          return GroundConstant(p->boolConst.value ? 1 : 0, c);
+                        r = c.New(rfBoolean);
+                        c.Emit(opBConst, r.r, p->boolConst.value);
+                        return r;
+
+    case typeId:        r = c.New(rfBoolean);
+                        c.Emit(opBVar, r.r, p->id.n);
+                        return r;
+
+    case typeOpr:
+        switch(p->opr.oper) {
+        case '@':       if(p->opr.nops==2) {
+                          a = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Free(a);
+                          r = c.New(rfBoolean);
+                          c.Emit(opBEl, r.r, p->opr.op[0]->id.n, a.r);
+                        }
+                        else {
+                          b = ToIndex(CompileNumber(p->opr.op[2], c, ground), c);
+                          a = ToIndex(CompileNumber(p->opr.op[1], c, ground), c);
+                          c.Free(a);
+                          c.Free(b);
+                          r = c.New(rfBoolean);
+                          c.Emit(opBEl2, r.r, p->opr.op[0]->id.n, a.r, b.r);
+                        }
+                        return r;
+
+        case LOGICALAND:op = opLAnd; gop = opGLAnd; goto logical;
+        case LOGICALOR: op = opLOr; gop = opGLOr; goto logical;
+        case LOGICALXOR:op = opLXor; gop = opGLXor;
+        logical:        b = CompileBoolean(p->opr.op[1], c, ground);
+                        a = CompileBoolean(p->opr.op[0], c, ground);
+                        return Binary(op, gop, rfBoolean, rfBoolean, a, b, c);
+
+        case '!':       return Unary(opNot, opGNot, rfBoolean, CompileBoolean(p->opr.op[0], c, ground), c);
+
+        case '<':       op = opLt; gop = opGLt; goto relation;
+        case '>':       op = opGt; gop = opGGt; goto relation;
+        case  LE:       op = opLe; gop = opGLe; goto relation;
+        case  GE:       op = opGe; gop = opGGe; goto relation;
+        case  EQ:       op = opEq; gop = opGEq; goto relation;
+        case  NE:       op = opNe; gop = opGNe;
+        relation:       b = CompileNumber(p->opr.op[1], c, ground);
+                        a = CompileNumber(p->opr.op[0], c, ground);
+                        return Binary(op, gop, rfNumber, rfBoolean, a, b, c);
+
+        // sgt(a, b) is slt(b, a), sle(a, b) is !slt(b, a) and sge(a, b) is
+        // !slt(a, b)
+        case SLT:       a = CompileNumber(p->opr.op[0], c, ground);
+                        b = CompileNumber(p->opr.op[1], c, ground);
+                        return Binary(opSLt, opGSLt, rfNumber, rfBoolean, a, b, c);
+        case SGT:
+        case SLE:       b = CompileNumber(p->opr.op[1], c, ground);
+                        a = CompileNumber(p->opr.op[0], c, ground);
+                        r = Binary(opSLt, opGSLt, rfNumber, rfBoolean, b, a, c);
+                        if (p->opr.oper == SLE)
+                          r = Unary(opNot, opGNot, rfBoolean, r, c);
+                        return r;
+        case SGE:       a = CompileNumber(p->opr.op[0], c, ground);
+                        b = CompileNumber(p->opr.op[1], c, ground);
+                        r = Binary(opSLt, opGSLt, rfNumber, rfBoolean, a, b, c);
+                        return Unary(opNot, opGNot, rfBoolean, r, c);
+
+        case ITE:       a = CompileBoolean(p->opr.op[1], c, ground);
+                        b = CompileBoolean(p->opr.op[2], c, ground);
+                        d = CompileBoolean(p->opr.op[0], c, ground);
+                        if (a.file == rfGround && b.file == rfGround && d.file == rfGround) {
+                          c.Free(a);
+                          c.Free(b);
+                          c.Free(d);
+                          r = c.New(rfGround);
+                          c.Emit(opGIte, r.r, a.r, b.r, d.r);
+                          return r;
+                        }
+                        a = ToBoolean(a, c);
+                        b = ToBoolean(b, c);
+                        d = ToBoolean(d, c);
+                        c.Free(a);
+                        c.Free(b);
+                        c.Free(d);
+                        r = c.New(rfBoolean);
+                        c.Emit(opBIte, r.r, a.r, b.r, d.r);
+                        return r;
+
+        case NUM2BOOL:  return Unary(opNum2Bool, opGSgn, rfBoolean, CompileNumber(p->opr.op[0], c, ground), c);
+
+        case ATMOST:
+        case ATLEAST:
+        case EXACTLY:
+        case PB_LE:     Spill(ground, c);
+                        r = c.New(rfBoolean);
+                        c.Emit(opBTree, r.r, 0, 0, 0, p);
+                        return r;
+        }
+    default: break;
+    }
+
+    r = c.New(rfBoolean);
+    c.Emit(opBConst, r.r, false);
+    return r;
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+// runs the code, or returns false if some of its inputs is not ground
+bool Interpreter::Run(const Bytecode& c) {
+    vector<unsigned long> g(c.nRegisters[rfGround]), v(c.groundVars.size());
+    for (unsigned int i = 0; i < c.inputs.size(); i++)
+      if (!m_ST.getGroundIntValue(c.inputs[i], v[c.groundVars.find(c.inputs[i])->second]))
+        return false;
+
+    vector<Number> n(c.nRegisters[rfNumber], Number((unsigned int)0));
+    vector<Boolean> b(c.nRegisters[rfBoolean], Boolean(false));
+
+    // the ground values are used only when numbers have at most 64 bits
+    const unsigned int l = iAbstractNumberLength;
+    const unsigned long mask = (l >= 64 ? ~0ul : (1ul << l) - 1);
+    const unsigned long sign = (l <= 64 ? 1ul << (l - 1) : 0);
+
+    unsigned int pc = 0;
+    while (pc < c.code.size()) {
+      const Instruction& i = c.code[pc++];
+      switch(i.op) {
+        case opNConst:    n[i.a] = c.constants[i.b]; break;
+        case opNVar:      n[i.a] = m_ST.getIntValue(i.b, &iVarCounter); break;
+        case opNEl:       n[i.a] = m_ST.getIntElValue(i.b, g[i.c], &iVarCounter); break;
+        case opNEl2:      n[i.a] = m_ST.getIntElValue2(i.b, g[i.c], g[i.d], &iVarCounter); break;
+        case opNeg:       n[i.a] = n[i.b].negate(); break;
+        case opBitNot:    n[i.a] = n[i.b].bitnegate(); break;
+        case opAdd:       n[i.a] = n[i.b] + n[i.c]; break;
+        case opSub:       n[i.a] = n[i.b] - n[i.c]; break;
+        case opMul:       n[i.a] = n[i.b] * n[i.c]; break;
+        case opDiv:       n[i.a] = n[i.b] / n[i.c]; break;
+        case opMod:       n[i.a] = n[i.b] % n[i.c]; break;
+        case opAnd:       n[i.a] = n[i.b] & n[i.c]; break;
+        case opOr:        n[i.a] = n[i.b] | n[i.c]; break;
+        case opXor:       n[i.a] = n[i.b] ^ n[i.c]; break;
+        case opShl:       n[i.a] = n[i.b] << n[i.c]; break;
+        case opShr:       n[i.a] = n[i.b] >> n[i.c]; break;
+        case opNIte:      n[i.a] = n[i.b].ite(b[i.d], n[i.c]); break;
+        case opBool2Num:  n[i.a] = b[i.b].Int(); break;
+        case opSgn:       n[i.a] = n[i.b].sgn(); break;
+        case opG2N:       n[i.a] = Number(g[i.b]); break;
+
+        case opBConst:    b[i.a] = Boolean(i.b != 0); break;
+        case opBVar:      b[i.a] = m_ST.getBoolValue(i.b, &iVarCounter); break;
+        case opBEl:       b[i.a] = m_ST.getBoolElValue(i.b, g[i.c], &iVarCounter); break;
+        case opBEl2:      b[i.a] = m_ST.getBoolElValue2(i.b, g[i.c], g[i.d], &iVarCounter); break;
+        case opNot:       b[i.a] = b[i.b].negate(); break;
+        case opLAnd:      b[i.a] = b[i.b] & b[i.c]; break;
+        case opLOr:       b[i.a] = b[i.b] | b[i.c]; break;
+        case opLXor:      b[i.a] = b[i.b] ^ b[i.c]; break;
+        case opLt:        b[i.a] = n[i.b] < n[i.c]; break;
+        case opGt:        b[i.a] = n[i.b] > n[i.c]; break;
+        case opLe:        b[i.a] = n[i.b] <= n[i.c]; break;
+        case opGe:        b[i.a] = n[i.b] >= n[i.c]; break;
+        case opEq:        b[i.a] = n[i.b] == n[i.c]; break;
+        case opNe:        b[i.a] = n[i.b] != n[i.c]; break;
+        case opSLt:       b[i.a] = n[i.b].LessSigned(n[i.c]); break;
+        case opBIte:      b[i.a] = b[i.b].ite(b[i.d], b[i.c]); break;
+        case opNum2Bool:  b[i.a] = n[i.b].Bool(); break;
+        case opBTree:     b[i.a] = ReadBoolean(i.p); break;
+        case opG2B:       b[i.a] = Boolean(g[i.b] != 0); break;
+
+        case opGConst:    g[i.a] = c.groundConstants[i.b]; break;
+        case opGLoad:     g[i.a] = v[i.b]; break;
+        case opGNeg:      g[i.a] = (0 - g[i.b]) & mask; break;
+        case opGBitNot:   g[i.a] = ~g[i.b] & mask; break;
+        case opGAdd:      g[i.a] = (g[i.b] + g[i.c]) & mask; break;
+        case opGSub:      g[i.a] = (g[i.b] - g[i.c]) & mask; break;
+        case opGMul:      g[i.a] = (g[i.b] * g[i.c]) & mask; break;
+        // x / 0 has all bits set and x % 0 is x, as for GroundNumber
+        case opGDiv:      g[i.a] = (g[i.c] ? g[i.b] / g[i.c] : mask); break;
+        case opGMod:      g[i.a] = (g[i.c] ? g[i.b] % g[i.c] : g[i.b]); break;
+        case opGAnd:      g[i.a] = g[i.b] & g[i.c]; break;
+        case opGOr:       g[i.a] = g[i.b] | g[i.c]; break;
+        case opGXor:      g[i.a] = g[i.b] ^ g[i.c]; break;
+        case opGShl:      g[i.a] = (g[i.c] >= l ? 0 : (g[i.b] << g[i.c]) & mask); break;
+        case opGShr:      g[i.a] = (g[i.c] >= l ? 0 : g[i.b] >> g[i.c]); break;
+        case opGIte:      g[i.a] = (g[i.d] ? g[i.b] : g[i.c]); break;
+        case opGSgn:      g[i.a] = (g[i.b] != 0); break;
+        case opGLt:       g[i.a] = (g[i.b] < g[i.c]); break;
+        case opGGt:       g[i.a] = (g[i.b] > g[i.c]); break;
+        case opGLe:       g[i.a] = (g[i.b] <= g[i.c]); break;
+        case opGGe:       g[i.a] = (g[i.b] >= g[i.c]); break;
+        case opGEq:       g[i.a] = (g[i.b] == g[i.c]); break;
+        case opGNe:       g[i.a] = (g[i.b] != g[i.c]); break;
+        case opGSLt:      g[i.a] = ((g[i.b] ^ sign) < (g[i.c] ^ sign)); break;
+        case opGNot:      g[i.a] = !g[i.b]; break;
+        case opGLAnd:     g[i.a] = (g[i.b] && g[i.c]); break;
+        case opGLOr:      g[i.a] = (g[i.b] || g[i.c]); break;
+        case opGLXor:     g[i.a] = (g[i.b] != g[i.c]); break;
+        case opN2G:       g[i.a] = n[i.b].GetGroundValueUnsigned(); break;
+
+        case opLetN:      m_ST.letInt(i.a, n[i.b]); break;
+        case opLetNEl:    m_ST.letIntEl(i.a, g[i.b], n[i.c]); break;
+        case opLetNEl2:   m_ST.letIntEl2(i.a, g[i.b], g[i.c], n[i.d]); break;
+        case opLetB:      m_ST.letBool(i.a, b[i.b]); break;
+        case opLetBEl:    m_ST.letBoolEl(i.a, g[i.b], b[i.c]); break;
+        case opLetBEl2:   m_ST.letBoolEl2(i.a, g[i.b], g[i.c], b[i.d]); break;
+        case opGStore:    v[i.a] = g[i.b]; break;
+        case opGSpill:    m_ST.letInt(i.a, Number(v[i.b])); break;
+        case opJump:      pc = i.a; break;
+        case opJumpIfNot: if (!b[i.b].GetGroundValue()) pc = i.a; break;
+        case opGJumpIfNot:if (!g[i.b]) pc = i.a; break;
+        case opExecute:   ExecuteCommand(i.p); break;
+      }
+    }
+    return true;
+}
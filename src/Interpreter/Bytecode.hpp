@@ -0,0 +1,196 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010-2020, Predrag Janicic
+
+This file is part of URSA
+
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#ifndef __BYTECODE_H
+#define __BYTECODE_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include "ursa.h"
+#include "Number.hpp"
+
+using namespace std;
+
+
+// Before a command is executed, its tree is compiled to a bytecode for a
+// machine with three register files: numbers (n), booleans (b) and ground
+// values (g), native integers that are used when the numbers have at most
+// 64 bits. The variables are given by their interned ids, loops and ifs
+// become jumps, and the commands that are executed only once (assert,
+// print, call, ...) are left to the tree-walking interpreter.
+//
+// The expressions that are ground whenever the command runs (built from
+// constants and the number variables that were given ground values earlier
+// in the command) are computed in g, and such variables are kept in native
+// slots (v) and written to the symbol table only when the tree-walking
+// interpreter may read it, when they stop being ground and at the end.
+// A command is first compiled assuming that its number variables that are
+// ground when it is first executed are ground whenever it starts (these are
+// its inputs); if they are not, the code compiled without this is run.
+enum eOpcode {
+  // n[a] = ...
+  opNConst,     // constants[b]
+  opNVar,       // the variable b
+  opNEl,        // the element b[g[c]]
+  opNEl2,       // the element b[g[c]][g[d]]
+  opNeg,        // -n[b]
+  opBitNot,     // ~n[b]
+  opAdd,        // n[b] + n[c], and so on
+  opSub,
+  opMul,
+  opDiv,
+  opMod,
+  opAnd,
+  opOr,
+  opXor,
+  opShl,
+  opShr,
+  opNIte,       // ite(b[d], n[b], n[c])
+  opBool2Num,   // bool2num(b[b])
+  opSgn,        // sgn(n[b])
+  opG2N,        // g[b]
+
+  // b[a] = ...
+  opBConst,     // the constant b
+  opBVar,       // the variable b
+  opBEl,        // the element b[g[c]]
+  opBEl2,       // the element b[g[c]][g[d]]
+  opNot,        // !b[b]
+  opLAnd,       // b[b] && b[c], and so on
+  opLOr,
+  opLXor,
+  opLt,         // n[b] < n[c], and so on
+  opGt,
+  opLe,
+  opGe,
+  opEq,
+  opNe,
+  opSLt,        // the other signed relations are this one and opNot
+  opBIte,       // ite(b[d], b[b], b[c])
+  opNum2Bool,   // num2bool(n[b])
+  opBTree,      // the expression p, read by the tree-walking interpreter
+  opG2B,        // g[b] (0 or 1)
+
+  // g[a] = ..., truncated to the length of numbers; booleans are 0 and 1
+  opGConst,     // groundConstants[b]
+  opGLoad,      // v[b]
+  opGNeg,       // -g[b]
+  opGBitNot,    // ~g[b]
+  opGAdd,       // g[b] + g[c], and so on
+  opGSub,
+  opGMul,
+  opGDiv,
+  opGMod,
+  opGAnd,
+  opGOr,
+  opGXor,
+  opGShl,
+  opGShr,
+  opGIte,       // ite(g[d], g[b], g[c])
+  opGSgn,       // sgn(g[b]), also num2bool
+  opGLt,        // g[b] < g[c], and so on
+  opGGt,
+  opGLe,
+  opGGe,
+  opGEq,
+  opGNe,
+  opGSLt,
+  opGNot,       // !g[b]
+  opGLAnd,      // g[b] && g[c], and so on
+  opGLOr,
+  opGLXor,
+  opN2G,        // the value of the ground n[b], as an index
+
+  // commands
+  opLetN,       // the variable a = n[b]
+  opLetNEl,     // the element a[g[b]] = n[c]
+  opLetNEl2,    // the element a[g[b]][g[c]] = n[d]
+  opLetB,       // the same for booleans
+  opLetBEl,
+  opLetBEl2,
+  opGStore,     // v[a] = g[b]
+  opGSpill,     // the variable a = v[b]
+  opJump,       // go to a
+  opJumpIfNot,  // go to a if b[b] is false (it has to be ground)
+  opGJumpIfNot, // go to a if g[b] is 0
+  opExecute     // the command p, executed by the tree-walking interpreter
+};
+
+
+struct Instruction {
+  eOpcode op;
+  unsigned int a, b, c, d;
+  nodeType *p;
+};
+
+
+enum eRegisterFile { rfNumber, rfBoolean, rfGround };
+
+// a register holding the value of an expression
+struct Operand {
+  eRegisterFile file;
+  unsigned int r;
+};
+
+
+class Bytecode {
+public:
+  Bytecode () : pGeneric(NULL) { 
+    for (unsigned int i = 0; i < 3; i++) 
+      nRegisters[i] = nTop[i] = 0; 
+  };
+  ~Bytecode () { delete pGeneric; }
+
+  // the registers are allocated as a stack in each file while compiling,
+  // so each expression leaves its result in the lowest register it was given
+  Operand New(eRegisterFile file) {
+    Operand o = { file, nTop[file]++ };
+    if (nTop[file] > nRegisters[file])
+      nRegisters[file] = nTop[file];
+    return o;
+  }
+  void Free(const Operand& o) { nTop[o.file]--; }
+
+  // the native slot of a ground variable
+  unsigned int Slot(unsigned int nVarId) {
+    map<unsigned int, unsigned int>::iterator it = groundVars.find(nVarId);
+    if (it != groundVars.end())
+      return it->second;
+    unsigned int nSlot = groundVars.size();
+    groundVars[nVarId] = nSlot;
+    return nSlot;
+  }
+
+  unsigned int Emit(eOpcode op, unsigned int a, unsigned int b = 0, unsigned int c = 0, unsigned int d = 0, nodeType *p = NULL) {
+    Instruction i = { op, a, b, c, d, p };
+    code.push_back(i);
+    return code.size() - 1;
+  }
+
+  vector<Instruction> code;
+  vector<Number> constants;
+  vector<unsigned long> groundConstants;
+  map<unsigned int, unsigned int> groundVars;
+  vector<unsigned int> inputs;
+  Bytecode *pGeneric;
+  unsigned int nRegisters[3];
+
+private:
+  unsigned int nTop[3];
+};
+
+
+#endif
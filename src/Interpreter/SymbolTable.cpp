@@ -18,12 +18,14 @@ GNU General Public License for more details.
 #include <iomanip>
 #include <assert.h>
 #include <math.h>
+#include <stdlib.h>
+#include <algorithm>
 #include "SymbolTable.hpp"
 
 using namespace std;
 
 
-string itos(unsigned int i)
+string itos(unsigned long i)
 {
    stringstream ss; 
    ss << i;
@@ -31,17 +33,115 @@ string itos(unsigned int i)
 }
 
 
+map<const string, unsigned int, lstr > SymbolTable::SymbolIds;
+vector<string> SymbolTable::SymbolNames;
+
+
+unsigned int SymbolTable::Intern(const string& sVarName)
+{
+  map<const string, unsigned int, lstr>::iterator it = SymbolIds.find(sVarName);
+  if (it != SymbolIds.end())
+    return it->second;
+  SymbolNames.push_back(sVarName);
+  return SymbolIds[sVarName] = SymbolNames.size() - 1;
+}
+
+
+// called by the parser for each identifier
+unsigned int intern(const char* i)
+{
+  return SymbolTable::Intern(i);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+template <class T> void listSymbols(const vector<Symbol<T>*>& symbols, const vector<string>& names, vector<pair<string, T*> >& vars)
+{
+  for (unsigned int n = 0; n < symbols.size(); n++) {
+    if (symbols[n] == NULL)
+      continue;
+    if (symbols[n]->pScalar != NULL)
+      vars.push_back(make_pair(names[n], symbols[n]->pScalar));
+
+    vector<pair<unsigned long, T*> > elements;
+    symbols[n]->Elements.List(elements);
+    for (unsigned int i = 0; i < elements.size(); i++)
+      vars.push_back(make_pair(names[n] + "[" + itos(elements[i].first) + "]", elements[i].second));
+
+    vector<pair<unsigned long, SymbolArray<T>*> > rows;
+    symbols[n]->Elements2.List(rows);
+    for (unsigned int i = 0; i < rows.size(); i++) {
+      elements.clear();
+      rows[i].second->List(elements);
+      for (unsigned int j = 0; j < elements.size(); j++)
+        vars.push_back(make_pair(names[n] + "[" + itos(rows[i].first) + "][" + itos(elements[j].first) + "]", elements[j].second));
+    }
+  }
+  sort(vars.begin(), vars.end());
+}
+
+
+// sName is a variable name, possibly with one or two indices (e.g. nA[3][7])
+template <class T> T* findSymbol(const vector<Symbol<T>*>& symbols, const map<const string, unsigned int, lstr>& ids, const string& sName)
+{
+  size_t b = sName.find('[');
+  map<const string, unsigned int, lstr>::const_iterator it = ids.find(sName.substr(0, b));
+  if (it == ids.end() || it->second >= symbols.size() || symbols[it->second] == NULL)
+    return NULL;
+  Symbol<T>* symbol = symbols[it->second];
+  if (b == string::npos)
+    return symbol->pScalar;
+
+  char* end;
+  unsigned long i = strtoul(sName.c_str() + b + 1, &end, 10);
+  if (end[0] == ']' && end[1] == 0)
+    return symbol->Elements.Find(i);
+  if (end[0] != ']' || end[1] != '[')
+    return NULL;
+  unsigned long j = strtoul(end + 2, &end, 10);
+  SymbolArray<T>* row = symbol->Elements2.Find(i);
+  return (row != NULL && end[0] == ']' && end[1] == 0) ? row->Find(j) : NULL;
+}
+
+
+void SymbolTable::ListInt(vector<pair<string, Number*> >& vars)
+{
+  listSymbols(SymInt, SymbolNames, vars);
+}
+
+
+void SymbolTable::ListBool(vector<pair<string, Boolean*> >& vars)
+{
+  listSymbols(SymBool, SymbolNames, vars);
+}
+
+
+Number* SymbolTable::FindInt(const string& sName)
+{
+  return findSymbol(SymInt, SymbolIds, sName);
+}
+
+
+Boolean* SymbolTable::FindBool(const string& sName)
+{
+  return findSymbol(SymBool, SymbolIds, sName);
+}
+
+
+// ----------------------------------------------------------------------------
+
+
 void SymbolTable::Clear() {
-  map<const string, Number*, lstr>::iterator it;
-  for ( it=SymInt.begin() ; it != SymInt.end(); it++ )  
-    delete (*it).second;
-  
-  map<const string, Boolean*, lstr>::iterator itb;
-  for ( itb=SymBool.begin() ; itb != SymBool.end(); itb++ )  
-    delete (*itb).second;
+  for (unsigned int i = 0; i < SymInt.size(); i++)
+    delete SymInt[i];
+  for (unsigned int i = 0; i < SymBool.size(); i++)
+    delete SymBool[i];
 
   SymInt.clear();
   SymBool.clear();
+  IntWidth.clear();
 
   /*m_iVarCounter=0;*/
 }
@@ -49,18 +149,20 @@ void SymbolTable::Clear() {
 
 void SymbolTable::printSym()
 {
-  map<const string, Number*, lstr>::iterator it;
-  for ( it=SymInt.begin() ; it != SymInt.end(); it++ )  {
-    cout << (*it).first;
-    (*it).second->PrintStatus();
-//  (*it).second->PrintValue();
+  vector<pair<string, Number*> > ints;
+  ListInt(ints);
+  for (unsigned int i = 0; i < ints.size(); i++) {
+    cout << ints[i].first;
+    ints[i].second->PrintStatus();
+//  ints[i].second->PrintValue();
   }
   cout << endl;
-  map<const string, Boolean*, lstr>::iterator itb;
-  for ( itb=SymBool.begin() ; itb != SymBool.end(); itb++ )  {
-    cout << (*itb).first;
-    (*itb).second->PrintStatus();
-//  (*itb).second->PrintValue();
+  vector<pair<string, Boolean*> > bools;
+  ListBool(bools);
+  for (unsigned int i = 0; i < bools.size(); i++) {
+    cout << bools[i].first;
+    bools[i].second->PrintStatus();
+//  bools[i].second->PrintValue();
   }
   cout << endl;
 }
@@ -71,17 +173,19 @@ void SymbolTable::printSym()
 
 void SymbolTable::printIndependent(Valuation& model)
 {
-  map<const string, Number*, lstr>::iterator it;
-  for ( it=SymInt.begin() ; it != SymInt.end(); it++ )  {
-    if ((!(*it).second->IsGroundNumber()) && (*it).second->IsIndependent()) {   
-      cout << (*it).first << "=" << getGroundNumber((*it).second->GetID(),model) << endl; // prints only truncated numbers
+  vector<pair<string, Number*> > ints;
+  ListInt(ints);
+  for (unsigned int i = 0; i < ints.size(); i++) {
+    if ((!ints[i].second->IsGroundNumber()) && ints[i].second->IsIndependent()) {   
+      cout << ints[i].first << "=" << getGroundNumber(ints[i].second->GetID(),model) << endl; // prints only truncated numbers
     }
   }
-  map<const string, Boolean*, lstr>::iterator itb;
-  for ( itb=SymBool.begin() ; itb != SymBool.end(); itb++ )  {
-    if ((!(*itb).second->IsGroundBoolean()) && (*itb).second->IsIndependent()) {   
-      cout << (*itb).first << "=";
-      if(getGroundBoolean((*itb).second->GetID(),model)) 
+  vector<pair<string, Boolean*> > bools;
+  ListBool(bools);
+  for (unsigned int i = 0; i < bools.size(); i++) {
+    if ((!bools[i].second->IsGroundBoolean()) && bools[i].second->IsIndependent()) {   
+      cout << bools[i].first << "=";
+      if(getGroundBoolean(bools[i].second->GetID(),model)) 
         cout << "true" << endl;
       else
         cout << "false" << endl;
@@ -121,17 +225,20 @@ unsigned int SymbolTable::getGroundNumberMapped(unsigned int iCounter,Valuation&
 }
 
 
-void SymbolTable::printGroundNumberMapped(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId) {
+void SymbolTable::printGroundNumberMapped(unsigned int iCounter,unsigned int nWidth,bool bSigned,SATsolver* solver, unsigned int* pMappedVarId) {
     int pos;
     unsigned int nLen = (iAbstractNumberLength+7)/8;  
     unsigned char* pDigits = new unsigned char[nLen];
 	for(unsigned int i=0;i<nLen;i++) 
       pDigits[i]=0;
 
-    for(unsigned int i=iCounter+1;i<=iCounter+iAbstractNumberLength;i++) {
-      pos = iCounter+iAbstractNumberLength-i;
+    for(unsigned int i=iCounter+1;i<=iCounter+nWidth;i++) {
+      pos = iCounter+nWidth-i;
       pDigits[pos/8] |= ((solver->isTrueVar(pMappedVarId[i])) << (pos % 8));
     }
+    if(bSigned && solver->isTrueVar(pMappedVarId[iCounter+1]))
+      for(pos=nWidth;pos<(int)iAbstractNumberLength;pos++)
+        pDigits[pos/8] |= 1 << (pos % 8);
 
     if(nLen<=sizeof(unsigned int)) { // print solutions in the decimal form if they can fit into int, otherwise print in the hex form
       unsigned int s=0; 
@@ -141,7 +248,7 @@ void SymbolTable::printGroundNumberMapped(unsigned int iCounter,SATsolver* solve
     }
     else {
 	  cout << "0x";
-      for(unsigned int i=nLen;i>0;i--) {
+      for(int i=nLen-1;i>=0;i--) {
           cout << (char)((pDigits[i]>>4) >=10 ? 'A'+(pDigits[i]>>4)-10 : '0'+(pDigits[i]>>4));
           cout << (char)((pDigits[i]&15) >=10 ? 'A'+(pDigits[i]&15)-10 : '0'+(pDigits[i]&15)); 
 	  }
@@ -161,22 +268,24 @@ void SymbolTable::printMapping()
 {
   cout << endl << "-------------------------------------------------------------" << endl;
   cout << "Mapping between independent URSA variables and SAT variables:" << endl;
-  map<const string, Number*, lstr>::iterator it;
-  for ( it=SymInt.begin() ; it != SymInt.end(); it++ )  {
-    if ((!(*it).second->IsGroundNumber()) && (*it).second->IsIndependent()) {   
-      cout << (*it).first << "="; 
-      unsigned int iCounter = (*it).second->GetID();
-      for(unsigned int i=iCounter+1;i<=iCounter+iAbstractNumberLength;i++) 
-        cout << "|" << i;
+  vector<pair<string, Number*> > ints;
+  ListInt(ints);
+  for (unsigned int i = 0; i < ints.size(); i++) {
+    if ((!ints[i].second->IsGroundNumber()) && ints[i].second->IsIndependent()) {   
+      cout << ints[i].first << "="; 
+      unsigned int iCounter = ints[i].second->GetID();
+      for(unsigned int j=iCounter+1;j<=iCounter+ints[i].second->GetWidth();j++) 
+        cout << "|" << j;
       cout << "|" << endl;
     }
   }
 
-  map<const string, Boolean*, lstr>::iterator itb;
-  for ( itb=SymBool.begin() ; itb != SymBool.end(); itb++ )  {
-    if ((!(*itb).second->IsGroundBoolean()) && (*itb).second->IsIndependent()) {   
-      cout << (*itb).first << "=";
-      cout << "|" << (*itb).second->GetID()+1 << "|" << endl;
+  vector<pair<string, Boolean*> > bools;
+  ListBool(bools);
+  for (unsigned int i = 0; i < bools.size(); i++) {
+    if ((!bools[i].second->IsGroundBoolean()) && bools[i].second->IsIndependent()) {   
+      cout << bools[i].first << "=";
+      cout << "|" << bools[i].second->GetID()+1 << "|" << endl;
     }
   }
   cout << "-------------------------------------------------------------" << endl;
@@ -188,24 +297,27 @@ void SymbolTable::printMapping()
 // These functions work with a reduced set of original variables
 void SymbolTable::printIndependentMapped(SATsolver* solver, unsigned int* pMappedVarId)
 {
-  map<const string, Number*, lstr>::iterator it;
-  for ( it=SymInt.begin() ; it != SymInt.end(); it++ )  {
-    if ((!(*it).second->IsGroundNumber()) && (*it).second->IsIndependent()) {   
-//      cout << (*it).first << "=" << getGroundNumberMapped((*it).second->GetID(),solver, pMappedVarId) << endl;
-      cout << (*it).first << "="; 
+  vector<pair<string, Number*> > ints;
+  ListInt(ints);
+  for (unsigned int i = 0; i < ints.size(); i++) {
+    Number* n = ints[i].second;
+    if ((!n->IsGroundNumber()) && n->IsIndependent()) {   
+//      cout << ints[i].first << "=" << getGroundNumberMapped(n->GetID(),solver, pMappedVarId) << endl;
+      cout << ints[i].first << "="; 
       if(iAbstractNumberLength<=sizeof(unsigned int)) 
-        cout << getGroundNumberMapped((*it).second->GetID(),solver, pMappedVarId) << ";" << endl;
+        cout << getGroundNumberMapped(n->GetID(),n->GetWidth(),n->IsSigned(),solver, pMappedVarId) << ";" << endl;
       else {
-        printGroundNumberMapped((*it).second->GetID(),solver, pMappedVarId);
+        printGroundNumberMapped(n->GetID(),n->GetWidth(),n->IsSigned(),solver, pMappedVarId);
         cout << ";" << endl;
       }
     }
   }
-  map<const string, Boolean*, lstr>::iterator itb;
-  for ( itb=SymBool.begin() ; itb != SymBool.end(); itb++ )  {
-    if ((!(*itb).second->IsGroundBoolean()) && (*itb).second->IsIndependent()) {   
-      cout << (*itb).first << "=";
-      if(getGroundBooleanMapped((*itb).second->GetID(),solver, pMappedVarId)) 
+  vector<pair<string, Boolean*> > bools;
+  ListBool(bools);
+  for (unsigned int i = 0; i < bools.size(); i++) {
+    if ((!bools[i].second->IsGroundBoolean()) && bools[i].second->IsIndependent()) {   
+      cout << bools[i].first << "=";
+      if(getGroundBooleanMapped(bools[i].second->GetID(),solver, pMappedVarId)) 
         cout << "true;" << endl;
       else
         cout << "false;" << endl;
@@ -216,12 +328,16 @@ void SymbolTable::printIndependentMapped(SATsolver* solver, unsigned int* pMappe
 
 // ----------------------------------------------------------------------------
 
-unsigned int SymbolTable::getGroundNumberMapped(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId) {
+// a number has nWidth variables, the bits above them are zero or, for
+// signed numbers, copies of the highest one
+unsigned int SymbolTable::getGroundNumberMapped(unsigned int iCounter,unsigned int nWidth,bool bSigned,SATsolver* solver, unsigned int* pMappedVarId) {
   unsigned int n=0;
-  for(unsigned int i=iCounter+1;i<=iCounter+iAbstractNumberLength;i++) {
+  for(unsigned int i=iCounter+1;i<=iCounter+nWidth;i++) {
     n = n << 1;
     n |= solver->isTrueVar(pMappedVarId[i]);
   }
+  if(bSigned && nWidth<iAbstractNumberLength && solver->isTrueVar(pMappedVarId[iCounter+1]))
+    n |= ((1u << iAbstractNumberLength) - 1) & ~((1u << nWidth) - 1);
   return n;
 }
 
@@ -238,73 +354,149 @@ bool SymbolTable::getGroundBooleanMapped(unsigned int iCounter,SATsolver* solver
 
 
 
-bool SymbolTable::DefinedIntVar(const string sVarName)
+Symbol<Number>* SymbolTable::IntSymbol(unsigned int nVarId)
+{
+   if (nVarId >= SymInt.size())
+      SymInt.resize(SymbolNames.size(), NULL);
+   if (SymInt[nVarId] == NULL)
+      SymInt[nVarId] = new Symbol<Number>;
+   return SymInt[nVarId];
+}
+
+
+Number*& SymbolTable::IntSlot(unsigned int nVarId, unsigned long nIndex)
+{
+   return IntSymbol(nVarId)->Elements.Slot(nIndex);
+}
+
+
+Number*& SymbolTable::IntSlot(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2)
+{
+   SymbolArray<Number>*& pRow = IntSymbol(nVarId)->Elements2.Slot(nIndex1);
+   if (pRow == NULL)
+      pRow = new SymbolArray<Number>;
+   return pRow->Slot(nIndex2);
+}
+
+
+bool SymbolTable::DefinedIntVar(unsigned int nVarId)
 {  
-   if( SymInt.find(sVarName) != SymInt.end() )  
-     return true;
-/*   if( SymBool.find(sVarName) != SymBool.end() )  
-     return true;*/
-   return false;
+   return nVarId < SymInt.size() && SymInt[nVarId] != NULL && SymInt[nVarId]->pScalar != NULL;
 }
 
 
-void SymbolTable::letInt(const string sVarName, const Number nValue)
+void SymbolTable::letInt(Number*& pVar, const Number& nValue)
 {  
-   if (!DefinedIntVar(sVarName)) { 
-     SymInt[sVarName] = new Number(nValue);
-   }
-   else {
-      *SymInt[sVarName] = nValue;
-   }
-   SetAccessedIntVar(sVarName, true);
-   SymbolTable::SymInt[sVarName]->SetIsDependent();
+   if (pVar == NULL)
+     pVar = new Number(nValue);
+   else 
+     *pVar = nValue;
+   pVar->SetAccessed(true);
+   pVar->SetIsDependent();
 } 
 
 
+void SymbolTable::letInt(unsigned int nVarId, const Number& nValue)
+{  
+   letInt(IntSymbol(nVarId)->pScalar, nValue);
+} 
 
-void SymbolTable::letIntEl(const string sVarName, const Number& nIndex, const Number& nValue)
+
+
+void SymbolTable::letIntEl(unsigned int nVarId, const Number& nIndex, const Number& nValue)
 {
    assert ( nIndex.IsGroundNumber() );
 
-   string sName = sVarName + "[" + itos(nIndex.GetGroundValueUnsigned()) + "]";
-   letInt(sName,nValue);
+   letIntEl(nVarId, nIndex.GetGroundValueUnsigned(), nValue);
 }
 
 
-void SymbolTable::letIntEl2(const string sVarName, const Number& nIndex1, const Number& nIndex2, const Number& nValue)
+void SymbolTable::letIntEl2(unsigned int nVarId, const Number& nIndex1, const Number& nIndex2, const Number& nValue)
 {
    assert( nIndex1.IsGroundNumber() && nIndex2.IsGroundNumber() );
 
-   string sName = sVarName + "[" + itos(nIndex1.GetGroundValueUnsigned()) + "][" + itos(nIndex2.GetGroundValueUnsigned()) + "]";
-   letInt(sName,nValue);
+   letIntEl2(nVarId, nIndex1.GetGroundValueUnsigned(), nIndex2.GetGroundValueUnsigned(), nValue);
+}
+
+
+void SymbolTable::letIntEl(unsigned int nVarId, unsigned long nIndex, const Number& nValue)
+{
+   letInt(IntSlot(nVarId, nIndex), nValue);
+}
+
+
+void SymbolTable::letIntEl2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, const Number& nValue)
+{
+   letInt(IntSlot(nVarId, nIndex1, nIndex2), nValue);
 }
 
 
 
-const Number SymbolTable::getIntValue(const string sVarName, unsigned int* iVarCounter)
+Number SymbolTable::getIntValue(Number*& pVar, unsigned int nVarId, unsigned int* iVarCounter)
 {
-   if(!DefinedIntVar(sVarName))
+   if (pVar == NULL)
    {
-      Number* n = new Number(iVarCounter);
-      n->SetType(eAbstractNumber);
-      SymInt[sVarName]=n;
+      if (nVarId < IntWidth.size() && IntWidth[nVarId].first != 0) 
+         pVar = new Number(iVarCounter, IntWidth[nVarId].first, IntWidth[nVarId].second);
+      else
+         pVar = new Number(iVarCounter);
+      pVar->SetType(eAbstractNumber);
    }
-   SetAccessedIntVar(sVarName, true);
-   return *SymInt[sVarName];
+   pVar->SetAccessed(true);
+   return *pVar;
+}
+
+
+Number SymbolTable::getIntValue(unsigned int nVarId, unsigned int* iVarCounter)
+{
+   return getIntValue(IntSymbol(nVarId)->pScalar, nVarId, iVarCounter);
+}
+
+
+bool SymbolTable::getGroundIntValue(unsigned int nVarId, unsigned long& nValue)
+{
+   if (!DefinedIntVar(nVarId) || !SymInt[nVarId]->pScalar->IsGroundNumber())
+      return false;
+   nValue = SymInt[nVarId]->pScalar->GetGroundValueUnsigned();
+   return true;
+}
+
+
+// the numbers that the variable (or the elements of the array) will get
+// when first read have only nWidth variables, zero or sign extended
+void SymbolTable::setIntWidth(unsigned int nVarId, unsigned int nWidth, bool bSigned)
+{
+   if (DefinedIntVar(nVarId) && !SymInt[nVarId]->pScalar->IsGroundNumber() && SymInt[nVarId]->pScalar->IsIndependent()) {
+      cout << "The width of the variable " << Name(nVarId) << " has to be given before its first use." << endl;
+      exit(1);
+   }
+   if (nVarId >= IntWidth.size())
+      IntWidth.resize(SymbolNames.size(), make_pair(0u, false));
+   IntWidth[nVarId] = make_pair(nWidth, bSigned);
+}
+
+
+Number SymbolTable::getIntElValue(unsigned int nVarId, const Number& nIndex, unsigned int* iVarCounter)
+{
+   return getIntElValue(nVarId, nIndex.GetGroundValueUnsigned(), iVarCounter);
+}
+
+    
+Number SymbolTable::getIntElValue2(unsigned int nVarId, const Number& nIndex1, const Number& nIndex2, unsigned int* iVarCounter)
+{
+   return getIntElValue2(nVarId, nIndex1.GetGroundValueUnsigned(), nIndex2.GetGroundValueUnsigned(), iVarCounter);
 }
 
 
-const Number SymbolTable::getIntElValue(const string sVarName, const Number& nIndex, unsigned int* iVarCounter)
+Number SymbolTable::getIntElValue(unsigned int nVarId, unsigned long nIndex, unsigned int* iVarCounter)
 {
-   string sName = sVarName + "[" + itos(nIndex.GetGroundValueUnsigned()) + "]";
-   return getIntValue(sName, iVarCounter);
+   return getIntValue(IntSlot(nVarId, nIndex), nVarId, iVarCounter);
 }
 
     
-const Number SymbolTable::getIntElValue2(const string sVarName, const Number& nIndex1, const Number& nIndex2, unsigned int* iVarCounter)
+Number SymbolTable::getIntElValue2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, unsigned int* iVarCounter)
 {
-   string sName = sVarName + "[" + itos(nIndex1.GetGroundValueUnsigned()) + "][" + itos(nIndex2.GetGroundValueUnsigned()) + "]";
-   return getIntValue(sName, iVarCounter);
+   return getIntValue(IntSlot(nVarId, nIndex1, nIndex2), nVarId, iVarCounter);
 }
 
 
@@ -312,106 +504,157 @@ const Number SymbolTable::getIntElValue2(const string sVarName, const Number& nI
 // -----------------------------------------------------
 
 
-bool SymbolTable::DefinedBoolVar(const string sVarName)
+Symbol<Boolean>* SymbolTable::BoolSymbol(unsigned int nVarId)
+{
+   if (nVarId >= SymBool.size())
+      SymBool.resize(SymbolNames.size(), NULL);
+   if (SymBool[nVarId] == NULL)
+      SymBool[nVarId] = new Symbol<Boolean>;
+   return SymBool[nVarId];
+}
+
+
+Boolean*& SymbolTable::BoolSlot(unsigned int nVarId, unsigned long nIndex)
+{
+   return BoolSymbol(nVarId)->Elements.Slot(nIndex);
+}
+
+
+Boolean*& SymbolTable::BoolSlot(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2)
+{
+   SymbolArray<Boolean>*& pRow = BoolSymbol(nVarId)->Elements2.Slot(nIndex1);
+   if (pRow == NULL)
+      pRow = new SymbolArray<Boolean>;
+   return pRow->Slot(nIndex2);
+}
+
+
+bool SymbolTable::DefinedBoolVar(unsigned int nVarId)
 {  
-   if( SymBool.find(sVarName) != SymBool.end() )  
-     return true;
-   else
-     return false;
+   return nVarId < SymBool.size() && SymBool[nVarId] != NULL && SymBool[nVarId]->pScalar != NULL;
 }
 
 
 
-void SymbolTable::letBool(const string sVarName, const Boolean bValue)
+void SymbolTable::letBool(Boolean*& pVar, const Boolean& bValue)
 {
-/*   if (!DefinedIntVar(sVarName))*/
-   if (!DefinedBoolVar(sVarName))
-      SymBool[sVarName] = new Boolean(bValue);
+   if (pVar == NULL)
+      pVar = new Boolean(bValue);
    else 
-      *SymBool[sVarName] = bValue;
-   SetAccessedBoolVar(sVarName, true);
-   SymbolTable::SymBool[sVarName]->SetIsDependent();
+      *pVar = bValue;
+   pVar->SetAccessed(true);
+   pVar->SetIsDependent();
 } 
 
 
-void SymbolTable::letBoolEl(const string sVarName, const Number& nIndex, const Boolean bValue)
+void SymbolTable::letBool(unsigned int nVarId, const Boolean& bValue)
+{
+   letBool(BoolSymbol(nVarId)->pScalar, bValue);
+} 
+
+
+void SymbolTable::letBoolEl(unsigned int nVarId, const Number& nIndex, const Boolean& bValue)
 {
    assert( nIndex.IsGroundNumber() );
 
-   string sName = sVarName + "[" + itos(nIndex.GetGroundValueUnsigned()) + "]";
-   letBool(sName,bValue);
+   letBoolEl(nVarId, nIndex.GetGroundValueUnsigned(), bValue);
 }
 
 
-void SymbolTable::letBoolEl2(const string sVarName, const Number& nIndex1, const Number& nIndex2, const Boolean bValue)
+void SymbolTable::letBoolEl2(unsigned int nVarId, const Number& nIndex1, const Number& nIndex2, const Boolean& bValue)
 {
    assert( nIndex1.IsGroundNumber() && nIndex2.IsGroundNumber() );
 
-   string sName = sVarName + "[" + itos(nIndex1.GetGroundValueUnsigned()) + "][" + itos(nIndex2.GetGroundValueUnsigned()) + "]";
-   letBool(sName,bValue);
+   letBoolEl2(nVarId, nIndex1.GetGroundValueUnsigned(), nIndex2.GetGroundValueUnsigned(), bValue);
 }
 
 
+void SymbolTable::letBoolEl(unsigned int nVarId, unsigned long nIndex, const Boolean& bValue)
+{
+   letBool(BoolSlot(nVarId, nIndex), bValue);
+}
+
 
-const Boolean SymbolTable::getBoolValue(const string sVarName, unsigned int* iVarCounter)
+void SymbolTable::letBoolEl2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, const Boolean& bValue)
 {
-/*   if(!DefinedIntVar(sVarName))*/
-   if (!DefinedBoolVar(sVarName))
+   letBool(BoolSlot(nVarId, nIndex1, nIndex2), bValue);
+}
+
+
+
+Boolean SymbolTable::getBoolValue(Boolean*& pVar, unsigned int* iVarCounter)
+{
+   if (pVar == NULL)
    {
-      Boolean* b = new Boolean(iVarCounter);
-      b->SetType(eAbstractBoolean);
-      SymBool[sVarName]=b;
+      pVar = new Boolean(iVarCounter);
+      pVar->SetType(eAbstractBoolean);
    }
-   SetAccessedBoolVar(sVarName, true);
-   return *SymBool[sVarName];
+   pVar->SetAccessed(true);
+   return *pVar;
+}
+
+
+Boolean SymbolTable::getBoolValue(unsigned int nVarId, unsigned int* iVarCounter)
+{
+   return getBoolValue(BoolSymbol(nVarId)->pScalar, iVarCounter);
+}
+
+
+Boolean SymbolTable::getBoolElValue(unsigned int nVarId, const Number& nIndex, unsigned int* iVarCounter)
+{
+   return getBoolElValue(nVarId, nIndex.GetGroundValueUnsigned(), iVarCounter);
+}
+
+
+Boolean SymbolTable::getBoolElValue2(unsigned int nVarId, const Number& nIndex1, const Number& nIndex2, unsigned int* iVarCounter)
+{
+   return getBoolElValue2(nVarId, nIndex1.GetGroundValueUnsigned(), nIndex2.GetGroundValueUnsigned(), iVarCounter);
 }
 
 
-const Boolean SymbolTable::getBoolElValue(const string sVarName, const Number& nIndex, unsigned int* iVarCounter)
+Boolean SymbolTable::getBoolElValue(unsigned int nVarId, unsigned long nIndex, unsigned int* iVarCounter)
 {
-   string sName = sVarName + "[" + itos(nIndex.GetGroundValueUnsigned()) + "]";
-   return getBoolValue(sName,iVarCounter);
+   return getBoolValue(BoolSlot(nVarId, nIndex), iVarCounter);
 }
 
 
-const Boolean SymbolTable::getBoolElValue2(const string sVarName, const Number& nIndex1, const Number& nIndex2, unsigned int* iVarCounter)
+Boolean SymbolTable::getBoolElValue2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, unsigned int* iVarCounter)
 {
-   string sName = sVarName + "[" + itos(nIndex1.GetGroundValueUnsigned()) + "][" + itos(nIndex2.GetGroundValueUnsigned()) + "]";
-   return getBoolValue(sName, iVarCounter);
+   return getBoolValue(BoolSlot(nVarId, nIndex1, nIndex2), iVarCounter);
 }
 
-bool SymbolTable::SetAccessedIntVar(const string sVarName, bool bA)
+bool SymbolTable::SetAccessedIntVar(unsigned int nVarId, bool bA)
 {  
-  if( SymInt.find(sVarName) != SymInt.end() )  {
-    SymInt.find(sVarName)->second->SetAccessed(bA);
+  if (DefinedIntVar(nVarId)) {
+    SymInt[nVarId]->pScalar->SetAccessed(bA);
     return true;  
   }
   else 
     return false;
 }
 
-bool SymbolTable::GetAccessedIntVar(const string sVarName)
+bool SymbolTable::GetAccessedIntVar(unsigned int nVarId)
 {  
-  if( SymInt.find(sVarName) != SymInt.end() )  
-    return SymInt.find(sVarName)->second->GetAccessed();
+  if (DefinedIntVar(nVarId))
+    return SymInt[nVarId]->pScalar->GetAccessed();
   else 
     return false;
 }
 
-bool SymbolTable::SetAccessedBoolVar(const string sVarName, bool bA)
+bool SymbolTable::SetAccessedBoolVar(unsigned int nVarId, bool bA)
 {  
-  if( SymBool.find(sVarName) != SymBool.end() )  {
-    SymBool.find(sVarName)->second->SetAccessed(bA);
+  if (DefinedBoolVar(nVarId)) {
+    SymBool[nVarId]->pScalar->SetAccessed(bA);
     return true;
   }
   else 
     return false;
 }
 
-bool SymbolTable::GetAccessedBoolVar(const string sVarName)
+bool SymbolTable::GetAccessedBoolVar(unsigned int nVarId)
 {  
-  if( SymBool.find(sVarName) != SymBool.end() )  
-    return SymBool.find(sVarName)->second->GetAccessed();
+  if (DefinedBoolVar(nVarId))
+    return SymBool[nVarId]->pScalar->GetAccessed();
   else 
     return false;
 }
@@ -424,49 +667,39 @@ bool SymbolTable::GetAccessedBoolVar(const string sVarName)
 
 int SymbolTable::readProofParameter(SATsolver* solver, unsigned int* pMappedVarId, string& s)
 {
-      map<const string, Number*, lstr>::iterator it;
-      for ( it=SymInt.begin() ; it != SymInt.end(); it++ )  {
-        if ((!(*it).second->IsGroundNumber()) && (*it).second->IsIndependent()) {   
-          if (s == (*it).first) {
-             if(iAbstractNumberLength<=sizeof(unsigned int)) { 
-                return getGroundNumberMapped((*it).second->GetID(),solver, pMappedVarId);
-              }
-              else
-               return printGroundNumberMappedforLaTeX((*it).second->GetID(),solver, pMappedVarId);
-          }   
-        }
-      }       
-      if(!DefinedIntVar(s))
+      Number* n = FindInt(s);
+      if (n == NULL)
          return -1;
-      const Number num = *SymInt[s];
-      return num.GetGroundValueUnsigned();
+      if ((!n->IsGroundNumber()) && n->IsIndependent()) {   
+         if(iAbstractNumberLength<=sizeof(unsigned int)) { 
+            return getGroundNumberMapped(n->GetID(),n->GetWidth(),n->IsSigned(),solver, pMappedVarId);
+          }
+          else
+           return printGroundNumberMappedforLaTeX(n->GetID(),n->GetWidth(),n->IsSigned(),solver, pMappedVarId);
+      }       
+      return n->GetGroundValueUnsigned();
 }
 
 // ----------------------------------------------------------------------------
 
 bool SymbolTable::readBoolProofParameter(SATsolver* solver, unsigned int* pMappedVarId, string& s)
 {
-      map<const string, Boolean*, lstr>::iterator itb;
-      for ( itb=SymBool.begin() ; itb != SymBool.end(); itb++ )  {
-        if ((!(*itb).second->IsGroundBoolean()) && (*itb).second->IsIndependent()) {   
-          if (s == (*itb).first) {
-             if(iAbstractNumberLength<=sizeof(unsigned int)) { 
-                return getGroundBooleanMapped((*itb).second->GetID(),solver, pMappedVarId);
-              }
-              else
-               return printGroundNumberMappedforLaTeX((*itb).second->GetID(),solver, pMappedVarId);
-          }   
-        }
-      }       
-      if(!DefinedBoolVar(s))
+      Boolean* b = FindBool(s);
+      if (b == NULL)
          return -1;
-      const Boolean b = *SymBool[s];
-      return b.GetGroundValue();
+      if ((!b->IsGroundBoolean()) && b->IsIndependent()) {   
+         if(iAbstractNumberLength<=sizeof(unsigned int)) { 
+            return getGroundBooleanMapped(b->GetID(),solver, pMappedVarId);
+          }
+          else
+           return printGroundNumberMappedforLaTeX(b->GetID(),iAbstractNumberLength,false,solver, pMappedVarId);
+      }       
+      return b->GetGroundValue();
 }
 
 // ----------------------------------------------------------------------------
 
-int SymbolTable::printGroundNumberMappedforLaTeX(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId) {
+int SymbolTable::printGroundNumberMappedforLaTeX(unsigned int iCounter,unsigned int nWidth,bool bSigned,SATsolver* solver, unsigned int* pMappedVarId) {
     int value;
     int pos;
     unsigned int nLen = (iAbstractNumberLength+7)/8;  
@@ -474,10 +707,13 @@ int SymbolTable::printGroundNumberMappedforLaTeX(unsigned int iCounter,SATsolver
 	for(unsigned int i=0;i<nLen;i++) 
       pDigits[i]=0;
 
-    for(unsigned int i=iCounter+1;i<=iCounter+iAbstractNumberLength;i++) {
-      pos = iCounter+iAbstractNumberLength-i;
+    for(unsigned int i=iCounter+1;i<=iCounter+nWidth;i++) {
+      pos = iCounter+nWidth-i;
       pDigits[pos/8] |= ((solver->isTrueVar(pMappedVarId[i])) << (pos % 8));
     }
+    if(bSigned && solver->isTrueVar(pMappedVarId[iCounter+1]))
+      for(pos=nWidth;pos<(int)iAbstractNumberLength;pos++)
+        pDigits[pos/8] |= 1 << (pos % 8);
 
     if(nLen<=sizeof(unsigned int)) { // print solutions in the decimal form if they can fit into int, otherwise print in the hex form
       unsigned int s=0; 
@@ -488,7 +724,7 @@ int SymbolTable::printGroundNumberMappedforLaTeX(unsigned int iCounter,SATsolver
     else {
 	  cout << "0x";
       value = 0;
-      for(unsigned int i=nLen;i>0;i--) {
+      for(int i=nLen-1;i>=0;i--) {
           value += (char)((pDigits[i]>>4) >=10 ? 'A'+(pDigits[i]>>4)-10 : '0'+(pDigits[i]>>4));
           value +=  (char)((pDigits[i]&15) >=10 ? 'A'+(pDigits[i]&15)-10 : '0'+(pDigits[i]&15)); 
 	  }
@@ -17,6 +17,7 @@ GNU General Public License for more details.
 #define __SYMBOL_TABLE
 
 #include <map>
+#include <vector>
 #include <string>
 #include <iostream>
 #include "Number.hpp"
@@ -38,6 +39,83 @@ struct lstr
 };
 
 
+// The elements of an array variable, by their index. The indices below
+// the size of a growable vector are kept in it; an index is added to the
+// vector only if it is close to its size, so the (rare) big or scattered
+// indices are kept in a map instead. The array owns its elements.
+template <class T> class SymbolArray {
+public:
+  SymbolArray () { };
+  ~SymbolArray () { Clear(); };
+
+  T* Find(unsigned long i) const {
+    if (i < m_Dense.size())
+      return m_Dense[i];
+    typename map<unsigned long, T*>::const_iterator it = m_Sparse.find(i);
+    return it == m_Sparse.end() ? NULL : it->second;
+  }
+
+  T*& Slot(unsigned long i) {
+    if (i < m_Dense.size())
+      return m_Dense[i];
+    if (i < 2*m_Dense.size()+16) {
+      // the elements of the map that the vector now covers are moved to it
+      m_Dense.resize(i+1, NULL);
+      typename map<unsigned long, T*>::iterator it = m_Sparse.begin();
+      while (it != m_Sparse.end() && it->first <= i) {
+        m_Dense[it->first] = it->second;
+        m_Sparse.erase(it++);
+      }
+      return m_Dense[i];
+    }
+    return m_Sparse[i];
+  }
+
+  void Clear() {
+    for (unsigned long i = 0; i < m_Dense.size(); i++)
+      delete m_Dense[i];
+    typename map<unsigned long, T*>::iterator it;
+    for (it = m_Sparse.begin(); it != m_Sparse.end(); it++)
+      delete it->second;
+    m_Dense.clear();
+    m_Sparse.clear();
+  }
+
+  // the elements with their indices, in the order of the indices
+  void List(vector<pair<unsigned long, T*> >& elements) const {
+    for (unsigned long i = 0; i < m_Dense.size(); i++)
+      if (m_Dense[i] != NULL)
+        elements.push_back(make_pair(i, m_Dense[i]));
+    typename map<unsigned long, T*>::const_iterator it;
+    for (it = m_Sparse.begin(); it != m_Sparse.end(); it++)
+      elements.push_back(*it);
+  }
+
+private:
+  SymbolArray (const SymbolArray&);
+  SymbolArray& operator = (const SymbolArray&);
+
+  vector<T*> m_Dense;
+  map<unsigned long, T*> m_Sparse;
+};
+
+
+// A variable x of the program together with the elements x[i] and x[i][j]
+// of the arrays of the same name
+template <class T> struct Symbol {
+  Symbol () : pScalar(NULL) { };
+  ~Symbol () { delete pScalar; };
+
+  T* pScalar;
+  SymbolArray<T> Elements;
+  SymbolArray<SymbolArray<T> > Elements2;
+
+private:
+  Symbol (const Symbol&);
+  Symbol& operator = (const Symbol&);
+};
+
+
 class SymbolTable {
 
 public:
@@ -57,33 +135,51 @@ public:
 
   void printMapping();
   void printIndependentMapped(SATsolver* solver, unsigned int* pMappedVarId);
-  unsigned int getGroundNumberMapped(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId);
+  unsigned int getGroundNumberMapped(unsigned int iCounter,unsigned int nWidth,bool bSigned,SATsolver* solver, unsigned int* pMappedVarId);
   bool getGroundBooleanMapped(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId);
-  void printGroundNumberMapped(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId);
-
-  bool DefinedIntVar(const string sVarName);
-  void letInt(const string sVarName, const Number nValue);
-  void letIntEl(const string sVarName, const Number& nIndex, const Number& nValue);
-  void letIntEl2(const string sVarName, const Number& nIndex1, const Number& nIndex2, const Number& nValue);
-  const Number getIntValue(const string sVarName, unsigned int* iVarCounter);
-  const Number getIntElValue(const string sVarName, const Number& nIndex, unsigned int* iVarCounter);
-  const Number getIntElValue2(const string sVarName, const Number& nIndex1,const Number& nIndex2, unsigned int* iVarCounter);
-
-  bool DefinedBoolVar(const string sVarName);
-  void letBool(const string sVarName, const Boolean bValue);
-  void letBoolEl(const string sVarName, const Number& nIndex, const Boolean bValue);
-  void letBoolEl2(const string sVarName, const Number& nIndex1, const Number& nIndex2, const Boolean bValue);
-  const Boolean getBoolValue(const string sVarName, unsigned int* iVarCounter);
-  const Boolean getBoolElValue(const string sVarName, const Number& nIndex, unsigned int* iVarCounter);
-  const Boolean getBoolElValue2(const string sVarName, const Number& nIndex1,const Number& nIndex2, unsigned int* iVarCounter);
-
-  bool SetAccessedIntVar(const string sVarName, bool bA);
-  bool GetAccessedIntVar(const string sVarName);
-  bool SetAccessedBoolVar(const string sVarName, bool bA);
-  bool GetAccessedBoolVar(const string sVarName);
+  void printGroundNumberMapped(unsigned int iCounter,unsigned int nWidth,bool bSigned,SATsolver* solver, unsigned int* pMappedVarId);
+
+  // the names of the variables are interned: the parser gives each
+  // identifier the id of its name, and the variables are kept in vectors
+  // indexed by these ids
+  static unsigned int Intern(const string& sVarName);
+  static const string& Name(unsigned int nVarId) { return SymbolNames[nVarId]; }
+
+  bool DefinedIntVar(unsigned int nVarId);
+  void letInt(unsigned int nVarId, const Number& nValue);
+  void letIntEl(unsigned int nVarId, const Number& nIndex, const Number& nValue);
+  void letIntEl2(unsigned int nVarId, const Number& nIndex1, const Number& nIndex2, const Number& nValue);
+  Number getIntValue(unsigned int nVarId, unsigned int* iVarCounter);
+  Number getIntElValue(unsigned int nVarId, const Number& nIndex, unsigned int* iVarCounter);
+  Number getIntElValue2(unsigned int nVarId, const Number& nIndex1,const Number& nIndex2, unsigned int* iVarCounter);
+  // the same with the values of ground indices
+  void letIntEl(unsigned int nVarId, unsigned long nIndex, const Number& nValue);
+  void letIntEl2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, const Number& nValue);
+  Number getIntElValue(unsigned int nVarId, unsigned long nIndex, unsigned int* iVarCounter);
+  Number getIntElValue2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, unsigned int* iVarCounter);
+  void setIntWidth(unsigned int nVarId, unsigned int nWidth, bool bSigned);
+  // the value of a defined ground variable (that is not marked as accessed)
+  bool getGroundIntValue(unsigned int nVarId, unsigned long& nValue);
+
+  bool DefinedBoolVar(unsigned int nVarId);
+  void letBool(unsigned int nVarId, const Boolean& bValue);
+  void letBoolEl(unsigned int nVarId, const Number& nIndex, const Boolean& bValue);
+  void letBoolEl2(unsigned int nVarId, const Number& nIndex1, const Number& nIndex2, const Boolean& bValue);
+  Boolean getBoolValue(unsigned int nVarId, unsigned int* iVarCounter);
+  Boolean getBoolElValue(unsigned int nVarId, const Number& nIndex, unsigned int* iVarCounter);
+  Boolean getBoolElValue2(unsigned int nVarId, const Number& nIndex1,const Number& nIndex2, unsigned int* iVarCounter);
+  void letBoolEl(unsigned int nVarId, unsigned long nIndex, const Boolean& bValue);
+  void letBoolEl2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, const Boolean& bValue);
+  Boolean getBoolElValue(unsigned int nVarId, unsigned long nIndex, unsigned int* iVarCounter);
+  Boolean getBoolElValue2(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2, unsigned int* iVarCounter);
+
+  bool SetAccessedIntVar(unsigned int nVarId, bool bA);
+  bool GetAccessedIntVar(unsigned int nVarId);
+  bool SetAccessedBoolVar(unsigned int nVarId, bool bA);
+  bool GetAccessedBoolVar(unsigned int nVarId);
 
   // Export of coherent proofs (given the input is a specification of a coherent proof encoded 
-  int printGroundNumberMappedforLaTeX(unsigned int iCounter,SATsolver* solver, unsigned int* pMappedVarId);
+  int printGroundNumberMappedforLaTeX(unsigned int iCounter,unsigned int nWidth,bool bSigned,SATsolver* solver, unsigned int* pMappedVarId);
   int readProofParameter(SATsolver* solver, unsigned int* pMappedVarId, string& s);
   bool readBoolProofParameter(SATsolver* solver, unsigned int* pMappedVarId, string& s);
   void exportCoherentLogicProof2Txt(SATsolver* solver, unsigned int* pMappedVarId);
@@ -91,8 +187,31 @@ public:
 
 private:
 
-  map<const string, Number*, lstr > SymInt;
-  map<const string, Boolean*, lstr > SymBool;
+  static map<const string, unsigned int, lstr > SymbolIds;
+  static vector<string> SymbolNames;
+
+  Symbol<Number>* IntSymbol(unsigned int nVarId);
+  Symbol<Boolean>* BoolSymbol(unsigned int nVarId);
+  Number*& IntSlot(unsigned int nVarId, unsigned long nIndex);
+  Number*& IntSlot(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2);
+  Boolean*& BoolSlot(unsigned int nVarId, unsigned long nIndex);
+  Boolean*& BoolSlot(unsigned int nVarId, unsigned long nIndex1, unsigned long nIndex2);
+  void letInt(Number*& pVar, const Number& nValue);
+  Number getIntValue(Number*& pVar, unsigned int nVarId, unsigned int* iVarCounter);
+  void letBool(Boolean*& pVar, const Boolean& bValue);
+  Boolean getBoolValue(Boolean*& pVar, unsigned int* iVarCounter);
+
+  // all the variables and array elements with their names (e.g. nA[3]),
+  // sorted by the names
+  void ListInt(vector<pair<string, Number*> >& vars);
+  void ListBool(vector<pair<string, Boolean*> >& vars);
+  // the variable or array element of the given name (NULL if undefined)
+  Number* FindInt(const string& sName);
+  Boolean* FindBool(const string& sName);
+
+  vector<Symbol<Number>*> SymInt;
+  vector<Symbol<Boolean>*> SymBool;
+  vector<pair<unsigned int, bool> > IntWidth;
 
 };
 
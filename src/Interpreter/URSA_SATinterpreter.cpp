@@ -14,10 +14,13 @@ GNU General Public License for more details.
 **************************************************************************************/
 
 #include <iostream>
+#include <limits.h>
 #include "URSA_SATinterpreter.hpp"
 #include "ursa.tab.hpp"
 #include "FormulaFactory.h"
 #include "SATsolver.h"
+#include "DimacsWriter.h"
+#include "ClauseBuffer.h"
 #include "ArgoSATSolver.h"
 #include "ClaspSATSolver.h"
 #include "MiniSATSolver.h"
@@ -27,11 +30,16 @@ using namespace std;
 
 typedef enum { eArgoSAT, eClasp, eMiniSAT } eSolvers;
 eSolvers URSASolver;
+eAdders URSAAdder;
 unsigned int iAbstractNumberLength;
 bool bQuiet;
 bool bDimacsOnly;
 bool bMapping;
+bool bStatistics;
+bool bPolarityAware;
+bool bNativeXor;
 bool bCoherentLogicProofExport;
+map<const string, nodeType *, lstr > URSAprocedures;
 Interpreter in;
 
 unsigned int iVarCounter;
@@ -68,7 +76,11 @@ int main(int argc, char** argv) {
     bDimacsOnly=false;
     bCoherentLogicProofExport=false;
     bMapping=false;
+    bStatistics=false;
+    bPolarityAware=false;
+    bNativeXor=false;
     URSASolver = eClasp;
+    URSAAdder = eRippleCarry;
 
     for(i=1;i<argc;i++) {
       if(argv[i][0]=='-')
@@ -90,10 +102,23 @@ int main(int argc, char** argv) {
                         URSASolver = eMiniSAT;
                       break;
                       }
+           case 'a':  {
+                      char *p;
+                      for (p=argv[i]; *p; p++ ) 
+                        *p = tolower(*p);
+                      if(!strcmp(argv[i]+2,"koggestone"))
+                        URSAAdder = eKoggeStone;
+                      if(!strcmp(argv[i]+2,"brentkung"))
+                        URSAAdder = eBrentKung;
+                      break;
+                      }
            case 'd':  bDimacsOnly=true; break;
            case 'q':  bQuiet=true; break;
            case 'c':  bCoherentLogicProofExport=true; break;
            case 'm':  bMapping=true; break;
+           case 'v':  bStatistics=true; break;
+           case 'p':  bPolarityAware=true; break;
+           case 'x':  bNativeXor=true; break;
            case 'h':  
                       cout << "Usage: ./ursa [OPTIONS] ..." << endl << endl;
                       cout << "Solves specified problems by reducing them to SAT." << endl << endl;
@@ -102,6 +127,10 @@ int main(int argc, char** argv) {
                       cout << "-d - DIMACS output only" << endl;
                       cout << "-q - quite mode (models are not printed out)" << endl;
                       cout << "-m - prints mapping between URSA variables and SAT variables" << endl;
+                      cout << "-v - prints statistics on formula construction" << endl;
+                      cout << "-p - polarity-aware (Plaisted-Greenbaum) CNF encoding (not used when all solutions are sought)" << endl;
+                      cout << "-x - chains of xors given to the solver as native xor clauses (with -sargosat or -d)" << endl;
+                      cout << "-a - selects the adders (e.g., -aripple, -akoggestone, -abrentkung; default is ripple)" << endl;
                       cout << "-s - selects an underlying solvers (e.g., -sargosat, -sclasp, -sminisat; defaulf is clasp)" << endl << endl;
                       cout << "Example:" << endl;
                       cout << "./ursa -l10 < examples/CSP/queens.urs" << endl;
@@ -109,6 +138,7 @@ int main(int argc, char** argv) {
          } 
     }
 
+    FormulaFactory::Instance()->SetStatistics(bStatistics);
     iVarCounter=0;
     // yydebug=1;
     yyparse();
@@ -127,7 +157,7 @@ int main(int argc, char** argv) {
 
 int ex(nodeType *p) {
    in.RecordCommand(p);
-   return in.ExecuteCommand(p); 
+   return in.Execute(p); 
 }
 
 
@@ -202,8 +232,8 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                             return 0;
                           }
                         }
-                        Number n((unsigned int)nOptimalCandidate);
-                        m_ST.letInt(sOptimizationVarName, n);
+                        Number n(nOptimalCandidate);
+                        m_ST.letInt(nOptimizationVarId, n);
                       }
                       return 0;
 
@@ -216,8 +246,20 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                             return 0;
                           }
                         }
-                        Number n((unsigned int)nOptimalCandidate);
-                        m_ST.letInt(sOptimizationVarName, n);
+                        Number n(nOptimalCandidate);
+                        m_ST.letInt(nOptimizationVarId, n);
+                      }
+                      return 0;
+
+      case WIDTH:
+      case SWIDTH:    {
+                        Number w = ReadNumber(p->opr.op[1]);
+                        if (!w.IsGroundNumber() || w.GetGroundValueUnsigned() == 0) {
+                          cout << "The width of " << p->opr.op[0]->id.i << " has to be a positive ground number." << endl;
+                          exit(1);
+                        }
+                        unsigned long nWidth = w.GetGroundValueUnsigned();
+                        m_ST.setIntWidth(p->opr.op[0]->id.n, nWidth < iAbstractNumberLength ? nWidth : iAbstractNumberLength, p->opr.oper == SWIDTH);
                       }
                       return 0;
 
@@ -244,21 +286,21 @@ int Interpreter::ExecuteCommand(nodeType *p) {
 
       case '=':       if (p->opr.nops == 2) {
                         if (IsNumberId(p->opr.op[0]))  
-                           m_ST.letInt(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]));
+                           m_ST.letInt(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]));
                         else
-                          m_ST.letBool(p->opr.op[0]->id.i, ReadBoolean(p->opr.op[1])); 
+                          m_ST.letBool(p->opr.op[0]->id.n, ReadBoolean(p->opr.op[1])); 
                       }
                       else if (p->opr.nops == 3) {
                         if (IsNumberId(p->opr.op[0])) 
-                          m_ST.letIntEl(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2])); 
+                          m_ST.letIntEl(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2])); 
                         else
-                          m_ST.letBoolEl(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadBoolean(p->opr.op[2])); 
+                          m_ST.letBoolEl(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadBoolean(p->opr.op[2])); 
                       } 
                       else {
                         if (IsNumberId(p->opr.op[0])) 
-                          m_ST.letIntEl2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), ReadNumber(p->opr.op[3])); 
+                          m_ST.letIntEl2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), ReadNumber(p->opr.op[3])); 
                         else
-                          m_ST.letBoolEl2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), ReadBoolean(p->opr.op[3])); 
+                          m_ST.letBoolEl2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), ReadBoolean(p->opr.op[3])); 
                       }
                       return 0;
 
@@ -266,19 +308,19 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                       { 
                         Number n((unsigned int)0); Number nleft((unsigned int)0); Number nright((unsigned int)0);
                         if (p->opr.nops == 1) 
-                          nleft = m_ST.getIntValue(p->opr.op[0]->id.i,&iVarCounter); 
+                          nleft = m_ST.getIntValue(p->opr.op[0]->id.n,&iVarCounter); 
                         else if (p->opr.nops == 2) 
-                          nleft = m_ST.getIntElValue(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]),&iVarCounter); 
+                          nleft = m_ST.getIntElValue(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]),&iVarCounter); 
                         else 
-                          nleft = m_ST.getIntElValue2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
-                        nright=1;
+                          nleft = m_ST.getIntElValue2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
+                        nright=(unsigned int)1;
                         n = nleft + nright; 
                         if (p->opr.nops == 1) 
-                          m_ST.letInt(p->opr.op[0]->id.i, n); 
+                          m_ST.letInt(p->opr.op[0]->id.n, n); 
                         else if (p->opr.nops == 2) 
-                          m_ST.letIntEl(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), n); 
+                          m_ST.letIntEl(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), n); 
                         else 
-                          m_ST.letIntEl2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), n); 
+                          m_ST.letIntEl2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), n); 
                       }
                       return 0;
 
@@ -286,25 +328,27 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                       { 
                         Number n((unsigned int)0); Number nleft((unsigned int)0); Number nright((unsigned int)0);
                         if (p->opr.nops == 1) 
-                          nleft = m_ST.getIntValue(p->opr.op[0]->id.i,&iVarCounter); 
+                          nleft = m_ST.getIntValue(p->opr.op[0]->id.n,&iVarCounter); 
                         else if (p->opr.nops == 2) 
-                          nleft = m_ST.getIntElValue(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]),&iVarCounter); 
+                          nleft = m_ST.getIntElValue(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]),&iVarCounter); 
                         else 
-                          nleft = m_ST.getIntElValue2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
-                        nright=1;
+                          nleft = m_ST.getIntElValue2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
+                        nright=(unsigned int)1;
                         n = nleft - nright; 
                         if (p->opr.nops == 1) 
-                          m_ST.letInt(p->opr.op[0]->id.i, n); 
+                          m_ST.letInt(p->opr.op[0]->id.n, n); 
                         else if (p->opr.nops == 2) 
-                          m_ST.letIntEl(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), n); 
+                          m_ST.letIntEl(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), n); 
                         else 
-                          m_ST.letIntEl2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), n); 
+                          m_ST.letIntEl2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), n); 
                       }
                       return 0;
 
       case PLUSEQ: 
       case MINUSEQ:
       case MULTEQ:
+      case DIVEQ:
+      case MODEQ:
       case BITWISEANDEQ: 
       case BITWISEOREQ: 
       case BITWISEXOREQ:
@@ -314,17 +358,18 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                       Number n((unsigned int)0); Number nleft((unsigned int)0);
                       Boolean b(false),bleft(false);
                       if (p->opr.nops == 2) 
-                          nleft=m_ST.getIntValue(p->opr.op[0]->id.i,&iVarCounter); 
+                          nleft=m_ST.getIntValue(p->opr.op[0]->id.n,&iVarCounter); 
                       else if (p->opr.nops == 3) 
-                          nleft = m_ST.getIntElValue(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]),&iVarCounter); 
+                          nleft = m_ST.getIntElValue(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]),&iVarCounter); 
                       else 
-                          nleft = m_ST.getIntElValue2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
+                          nleft = m_ST.getIntElValue2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
 
                       switch(p->opr.oper) {
                         case PLUSEQ:   n = nleft + ReadNumber(p->opr.op[p->opr.nops-1]); break;
                         case MINUSEQ:  n = nleft - ReadNumber(p->opr.op[p->opr.nops-1]); break;
                         case MULTEQ:   n = nleft * ReadNumber(p->opr.op[p->opr.nops-1]); break;
-//                      case DIVEQ:    n = nleft + ReadNumber(p->opr.op[p->opr.nops-1]); break;
+                        case DIVEQ:    n = nleft / ReadNumber(p->opr.op[p->opr.nops-1]); break;
+                        case MODEQ:    n = nleft % ReadNumber(p->opr.op[p->opr.nops-1]); break;
                         case BITWISEANDEQ:  n = nleft & ReadNumber(p->opr.op[p->opr.nops-1]); break;
                         case BITWISEOREQ:   n = nleft | ReadNumber(p->opr.op[p->opr.nops-1]); break;
                         case BITWISEXOREQ:  n = nleft ^ ReadNumber(p->opr.op[p->opr.nops-1]); break;
@@ -333,11 +378,11 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                       }
 
                       if (p->opr.nops == 2) 
-                          m_ST.letInt(p->opr.op[0]->id.i, n); 
+                          m_ST.letInt(p->opr.op[0]->id.n, n); 
                       else if (p->opr.nops == 3) 
-                          m_ST.letIntEl(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), n); 
+                          m_ST.letIntEl(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), n); 
                       else 
-                          m_ST.letIntEl2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), n); 
+                          m_ST.letIntEl2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), n); 
               
                       return 0;
                    }
@@ -349,11 +394,11 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                       Number n((unsigned int)0); Number nleft((unsigned int)0);
                       Boolean b(false),bleft(false);
                       if (p->opr.nops == 2) 
-                          bleft=m_ST.getBoolValue(p->opr.op[0]->id.i,&iVarCounter); 
+                          bleft=m_ST.getBoolValue(p->opr.op[0]->id.n,&iVarCounter); 
                       else if (p->opr.nops == 3) 
-                          bleft = m_ST.getBoolElValue(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]),&iVarCounter); 
+                          bleft = m_ST.getBoolElValue(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]),&iVarCounter); 
                       else 
-                          bleft = m_ST.getBoolElValue2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
+                          bleft = m_ST.getBoolElValue2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
 
                       switch(p->opr.oper) {
                         case ANDEQ:   b = bleft & ReadBoolean(p->opr.op[p->opr.nops-1]); break;
@@ -362,11 +407,11 @@ int Interpreter::ExecuteCommand(nodeType *p) {
                       }
 
  	                    if (p->opr.nops == 2) 
-                        m_ST.letBool(p->opr.op[0]->id.i, b); 
+                        m_ST.letBool(p->opr.op[0]->id.n, b); 
                       else if (p->opr.nops == 3) 
-                        m_ST.letBoolEl(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), b); 
+                        m_ST.letBoolEl(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), b); 
      	                else 
-                        m_ST.letBoolEl2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), b); 
+                        m_ST.letBoolEl2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]), b); 
               
                       return 0;
                    }
@@ -389,20 +434,21 @@ Number Interpreter::ReadNumber(nodeType *p) {
                         return n; 
                         }
 
-    case typeId:        return m_ST.getIntValue(p->id.i,&iVarCounter);
+    case typeId:        return m_ST.getIntValue(p->id.n,&iVarCounter);
 
     case typeOpr:
         switch(p->opr.oper) {
         case '@':       if(p->opr.nops==2) {
-                          return m_ST.getIntElValue(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]),&iVarCounter); 
+                          return m_ST.getIntElValue(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]),&iVarCounter); 
                         }
                         else 
-                          return m_ST.getIntElValue2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
+                          return m_ST.getIntElValue2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
         case UMINUS:    return ReadNumber(p->opr.op[0]).negate();
         case '+':       return ReadNumber(p->opr.op[0]) + ReadNumber(p->opr.op[1]);
         case '-':       return ReadNumber(p->opr.op[0]) - ReadNumber(p->opr.op[1]);
         case '*':       return ReadNumber(p->opr.op[0]) * ReadNumber(p->opr.op[1]);
-//        case '/':       return ReadNumber(p->opr.op[0]) / ReadNumber(p->opr.op[1]);
+        case '/':       return ReadNumber(p->opr.op[0]) / ReadNumber(p->opr.op[1]);
+        case '%':       return ReadNumber(p->opr.op[0]) % ReadNumber(p->opr.op[1]);
         case '&':       return ReadNumber(p->opr.op[0]) & ReadNumber(p->opr.op[1]);
         case '|':       return ReadNumber(p->opr.op[0]) | ReadNumber(p->opr.op[1]);
         case '^':       return ReadNumber(p->opr.op[0]) ^ ReadNumber(p->opr.op[1]);
@@ -426,13 +472,13 @@ Boolean Interpreter::ReadBoolean(nodeType *p) {
     if (!p) { Boolean b(false); return b; } 
     switch(p->type) {
     case typeBoolConst: { Boolean b(p->boolConst.value); return b; };
-    case typeId:        return m_ST.getBoolValue(p->id.i,&iVarCounter);
+    case typeId:        return m_ST.getBoolValue(p->id.n,&iVarCounter);
     case typeOpr:
         switch(p->opr.oper) {
         case '@':       if(p->opr.nops==2)
-                          return m_ST.getBoolElValue(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]),&iVarCounter); 
+                          return m_ST.getBoolElValue(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]),&iVarCounter); 
                         else 
-                          return m_ST.getBoolElValue2(p->opr.op[0]->id.i, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
+                          return m_ST.getBoolElValue2(p->opr.op[0]->id.n, ReadNumber(p->opr.op[1]), ReadNumber(p->opr.op[2]),&iVarCounter); 
         case LOGICALAND:return ReadBoolean(p->opr.op[0]) & ReadBoolean(p->opr.op[1]);
         case LOGICALOR: return ReadBoolean(p->opr.op[0]) | ReadBoolean(p->opr.op[1]);
         case LOGICALXOR:return ReadBoolean(p->opr.op[0]) ^ ReadBoolean(p->opr.op[1]);
@@ -443,8 +489,35 @@ Boolean Interpreter::ReadBoolean(nodeType *p) {
         case  GE:       return ReadNumber(p->opr.op[0]) >= ReadNumber(p->opr.op[1]);   
         case  EQ:       return ReadNumber(p->opr.op[0]) == ReadNumber(p->opr.op[1]);   
         case  NE:       return ReadNumber(p->opr.op[0]) != ReadNumber(p->opr.op[1]);   
+        case SLT:       return ReadNumber(p->opr.op[0]).LessSigned(ReadNumber(p->opr.op[1]));
+        case SGT:       return ReadNumber(p->opr.op[1]).LessSigned(ReadNumber(p->opr.op[0]));
+        case SLE:       return ReadNumber(p->opr.op[1]).LessSigned(ReadNumber(p->opr.op[0])).negate();
+        case SGE:       return ReadNumber(p->opr.op[0]).LessSigned(ReadNumber(p->opr.op[1])).negate();
         case ITE:       return ReadBoolean(p->opr.op[1]).ite(ReadBoolean(p->opr.op[0]),ReadBoolean(p->opr.op[2]));
         case NUM2BOOL:  return ReadNumber(p->opr.op[0]).Bool();
+        case ATMOST:
+        case ATLEAST:
+        case EXACTLY:   {
+                          vector<Boolean> b;
+                          ReadBooleanList(p->opr.op[1], b, NULL);
+                          if (p->opr.oper == ATMOST)
+                            return Boolean::AtMost(b, ReadNumber(p->opr.op[0]));
+                          else if (p->opr.oper == ATLEAST)
+                            return Boolean::AtLeast(b, ReadNumber(p->opr.op[0]));
+                          else
+                            return Boolean::Exactly(b, ReadNumber(p->opr.op[0]));
+                        }
+        case PB_LE:     {
+                          vector<Boolean> b;
+                          vector<Number> w;
+                          Number k = ReadNumber(p->opr.op[0]);
+                          ReadBooleanList(p->opr.op[1], b, &w);
+                          if (!k.IsGroundNumber()) {
+                            cout << "The bound in pb_le has to be ground." << endl;
+                            exit(1);
+                          }
+                          return Boolean::WeightedAtMost(b, w, k);
+                        }
         }
     default: break;  
     }
@@ -455,6 +528,63 @@ Boolean Interpreter::ReadBoolean(nodeType *p) {
 // ----------------------------------------------------------------------------
 
 
+// arguments of cardinality constraints are booleans and ranges of elements
+// of boolean arrays; for pb_le each of them comes with a weight
+void Interpreter::ReadBooleanList(nodeType *p, vector<Boolean>& b, vector<Number>* w) {
+    vector<nodeType *> items;
+    while (p->type == typeOpr && p->opr.oper == ';') {
+      items.push_back(p->opr.op[1]);
+      p = p->opr.op[0];
+    }
+    items.push_back(p);
+
+    for (int i = items.size() - 1; i >= 0; i--) {
+      nodeType *q = items[i];
+      Number weight((unsigned int)1);
+      if (w) {
+        weight = ReadNumber(q->opr.op[0]);
+        if (!weight.IsGroundNumber()) {
+          cout << "The weights in pb_le have to be ground." << endl;
+          exit(1);
+        }
+        q = q->opr.op[1];
+      }
+
+      if (q->type == typeOpr && q->opr.oper == '.') {
+        int nops = q->opr.nops;
+        Number from = ReadNumber(q->opr.op[nops-2]);
+        Number to = ReadNumber(q->opr.op[nops-1]);
+        Number index = (nops == 4 ? ReadNumber(q->opr.op[1]) : Number((unsigned int)0));
+        if (!from.IsGroundNumber() || !to.IsGroundNumber()) {
+          cout << "The bounds of the range of " << q->opr.op[0]->id.i << " have to be ground." << endl;
+          exit(1);
+        }
+        // the loop stops at the upper bound itself, as j would wrap around
+        // past ULONG_MAX
+        unsigned long lo = from.GetGroundValueUnsigned(), hi = to.GetGroundValueUnsigned();
+        for (unsigned long j = lo; lo <= hi; j++) {
+          if (nops == 3)
+            b.push_back(m_ST.getBoolElValue(q->opr.op[0]->id.n, Number(j), &iVarCounter));
+          else
+            b.push_back(m_ST.getBoolElValue2(q->opr.op[0]->id.n, index, Number(j), &iVarCounter));
+          if (w)
+            w->push_back(weight);
+          if (j == hi)
+            break;
+        }
+      }
+      else {
+        b.push_back(ReadBoolean(q));
+        if (w)
+          w->push_back(weight);
+      }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
 bool Interpreter::Solve(nodeType *p, bool bAllSolutions) {
    if (pOptimizationConstraint) 
      SolveOptimizationProblem(p);
@@ -472,6 +602,7 @@ void Interpreter::setLimits(nodeType *p, const Number& min, const Number& max, b
    assert ( min.IsGroundNumber() );
    assert ( max.IsGroundNumber() );
    sOptimizationVarName = p->opr.op[0]->id.i;
+   nOptimizationVarId = p->opr.op[0]->id.n;
    nMin=min.GetGroundValueUnsigned();
    nMax=max.GetGroundValueUnsigned();
    bMaximize = bMax;
@@ -487,7 +618,7 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
    CTimer Timer;
    Timer.StartMeasuringTime();
 
-        unsigned best = 0;
+        unsigned long best = 0;
         while(nMin <= nMax)  {
             cout << "Testing the value " << nMin << " for the variable " << sOptimizationVarName << " ..." << endl;
             if(SolveConstraint(p,false)) {
@@ -498,19 +629,19 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
                 if (bMaximize) 
                     nMax /= 2;
                 else
-                    nMin *= 2;
+                    nMin = (nMin > nMax/2 ? nMax+1 : nMin*2);
                 m_ST.Clear();
                 FormulaFactory::Instance()->Clear();
                 nOptimalCandidate = bMaximize ? nMax : nMin;
-                m_ST.letInt(sOptimizationVarName, nOptimalCandidate);
+                m_ST.letInt(nOptimizationVarId, nOptimalCandidate);
                 vector<nodeType *>::iterator i;
                 for(i=URSAprogram.begin();i+1!=URSAprogram.end();i++)  //execute until the assert command
-                    ExecuteCommand(*i); 
+                    Execute(*i); 
             }
         }
 
         if (bMaximize) {
-            nMin = best; nMax = best*2-1;
+            nMin = best; nMax = (best > ULONG_MAX/2 ? ULONG_MAX : best*2-1);
         }   
         else { 
             nMin = best/2+1; nMax = best;
@@ -519,12 +650,12 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
         while(best && nMin <= nMax && ((nMin != best && !bMaximize)||(nMax != best && bMaximize)))  {
             m_ST.Clear();
             FormulaFactory::Instance()->Clear();
-            nOptimalCandidate = (nMin+nMax)/2;
-            m_ST.letInt(sOptimizationVarName, nOptimalCandidate);
+            nOptimalCandidate = nMin+(nMax-nMin)/2;
+            m_ST.letInt(nOptimizationVarId, nOptimalCandidate);
             cout << "Testing the value " << nOptimalCandidate << " for the variable " << sOptimizationVarName << " ..." << endl;
             vector<nodeType *>::iterator i;
             for(i=URSAprogram.begin();i+1!=URSAprogram.end();i++)  //execute until the assert command
-                ExecuteCommand(*i); 
+                Execute(*i); 
             if(SolveConstraint(p,false)) {
                 best = nOptimalCandidate;
                 nMax = nOptimalCandidate-1;
@@ -539,10 +670,10 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
             m_ST.Clear();
             FormulaFactory::Instance()->Clear();
             nOptimalCandidate = best;
-            m_ST.letInt(sOptimizationVarName, best);
+            m_ST.letInt(nOptimizationVarId, best);
             vector<nodeType *>::iterator i;
             for(i=URSAprogram.begin();i+1!=URSAprogram.end();i++)  //execute until the assert command
-                 ExecuteCommand(*i); 
+                 Execute(*i); 
         }
     
 
@@ -566,12 +697,12 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
          else 
            nMax = (nMin + nMax)/2;
  
-         Number n((unsigned int)((nMin+nMax)/2));
-         m_ST.letInt(sOptimizationVarName, n);
+         Number n((nMin+nMax)/2);
+         m_ST.letInt(nOptimizationVarId, n);
 
          vector<nodeType *>::iterator i;
          for(i=URSAprogram.begin();i+1!=URSAprogram.end();i++)  //execute until the assert command
-           ExecuteCommand(*i); 
+           Execute(*i); 
        }
      }
      else {
@@ -588,12 +719,12 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
        else 
          nMin = (nMin + nMax + 1)/2;
 
-       Number n((unsigned int)((nMin+nMax)/2));
-       m_ST.letInt(sOptimizationVarName, n);
+       Number n((nMin+nMax)/2);
+       m_ST.letInt(nOptimizationVarId, n);
 
        vector<nodeType *>::iterator i;
        for(i=URSAprogram.begin();i+1!=URSAprogram.end();i++)  //execute until the assert command
-         ExecuteCommand(*i); 
+         Execute(*i); 
      }
    } 
 
@@ -619,18 +750,18 @@ void Interpreter::SolveOptimizationProblem(nodeType *p) {
 
        if (bMaximize) {
          nMax--;
-         Number n((unsigned int)nMax);
-         m_ST.letInt(sOptimizationVarName, n);
+         Number n(nMax);
+         m_ST.letInt(nOptimizationVarId, n);
        }
        else {
          nMin++;
-         Number n((unsigned int)nMin);
-         m_ST.letInt(sOptimizationVarName, n);
+         Number n(nMin);
+         m_ST.letInt(nOptimizationVarId, n);
        }
 
        vector<nodeType *>::iterator i;
        for(i=URSAprogram.begin();i+1!=URSAprogram.end();i++)  //execute until the assert command
-         ExecuteCommand(*i); 
+         Execute(*i); 
      }
    } */
 
@@ -665,9 +796,9 @@ bool Interpreter::SolveConstraint(nodeType *p, bool bAllSolutions) {
   // cout << "--> constraint: " << endl;
   // bConstraint.print();
 
-   Formula* root=bConstraint.GetAbstractValue().getFormulaFrom(0);
-   if (root->GetType() == CONST) {
-       if (((FormulaConst*)root)->GetValue() == true) {
+   Formula root=bConstraint.GetAbstractValue().getFormulaFrom(0);
+   if (root.GetType() == CONST) {
+       if (root.GetValue() == true) {
         cout << "yes" << endl;
         return true;
       }
@@ -695,7 +826,7 @@ bool Interpreter::SolveConstraint(nodeType *p, bool bAllSolutions) {
   int varCount = iVarCounter;
 
   FormulaFactory::Instance()->SetIds(&varCount);
-  vector< vector<int> > conj;
+  unsigned long clauseCount = 0;
   int numOfModels = 0;
    
   unsigned int* pMappedVarId = new unsigned int[varCount+1];
@@ -704,7 +835,12 @@ bool Interpreter::SolveConstraint(nodeType *p, bool bAllSolutions) {
     m_ST.printMapping();
   }
  
-  if (!FormulaFactory::Instance()->GenerateCNF(bConstraint.GetAbstractValue(), conj, pMappedVarId, &varCount))  {
+  // with the polarity-aware encoding the values of the auxiliary variables
+  // are not determined by a model, so enumerating the models (which blocks
+  // all the variables) would report some solutions more than once
+  FormulaFactory::Instance()->SetPolarityAware(bPolarityAware && !bAllSolutions);
+  FormulaFactory::Instance()->SetNativeXor(bNativeXor && (bDimacsOnly || URSASolver == eArgoSAT));
+  if (!FormulaFactory::Instance()->CountCNF(bConstraint.GetAbstractValue(), pMappedVarId, &varCount, &clauseCount))  {
     cout << endl << "No solutions found" << endl;
     dTime_generation = m_Timer.ElapsedTime();
     m_Timer.StartMeasuringTime();
@@ -712,15 +848,13 @@ bool Interpreter::SolveConstraint(nodeType *p, bool bAllSolutions) {
   else
   { 
     if(bDimacsOnly) {
+      cout << "p cnf " << varCount << " " << clauseCount << " " << endl;
+      DimacsWriter dimacsWriter(cout);
+      FormulaFactory::Instance()->GenerateCNF(bConstraint.GetAbstractValue(), pMappedVarId, dimacsWriter);
+      cout.flush();
+
       dTime_generation = m_Timer.ElapsedTime();
       m_Timer.StartMeasuringTime();
-
-      cout << "p cnf " << varCount << " " << conj.size() << " " << endl;
-      for (vector<vector<int> >::iterator iter = conj.begin(); iter != conj.end(); iter++) {
-        for (vector<int>::iterator it = iter->begin(); it != iter->end(); it++) 
-          cout << *it << " ";                              
-        cout << "0" << endl;
-      }
     }
     else  {
 
@@ -733,9 +867,9 @@ bool Interpreter::SolveConstraint(nodeType *p, bool bAllSolutions) {
         pSolver = new ClaspSATsolver;
 
       pSolver->InitSolver(varCount);
-        
-      for (vector<vector<int> >::iterator iter = conj.begin(); iter != conj.end(); iter++) 
-        pSolver->addClause(*iter);
+      ClauseBuffer clauseBuffer(pSolver);
+      FormulaFactory::Instance()->GenerateCNF(bConstraint.GetAbstractValue(), pMappedVarId, clauseBuffer);
+      clauseBuffer.flush();
 
       dTime_generation = m_Timer.ElapsedTime();
       m_Timer.StartMeasuringTime();
@@ -771,7 +905,16 @@ bool Interpreter::SolveConstraint(nodeType *p, bool bAllSolutions) {
   dTime_solving = m_Timer.ElapsedTime();
   cout << "[Formula generation: " << dTime_parsing << "s; conversion to CNF: "<< dTime_generation << "s; total: " << dTime_parsing+dTime_generation << "s]" << endl; 
   cout << "[Solving time: " << dTime_solving << "s]" << endl;
-  cout << "[Formula size: " << varCount << " variables, " << conj.size() << " clauses]" << endl << endl;
+  cout << "[Formula size: " << varCount << " variables, " << clauseCount << " clauses";
+  if (bPolarityAware && !bAllSolutions) {
+    unsigned long skipped = FormulaFactory::Instance()->GetSkippedClauses();
+    cout << "; polarity-aware encoding saved " << skipped << " clauses (" 
+         << (clauseCount+skipped ? 100.0*skipped/(clauseCount+skipped) : 0) << "%)";
+  }
+  cout << "]" << endl;
+  if (bStatistics)
+    FormulaFactory::Instance()->PrintStatistics();
+  cout << endl;
 
   return (numOfModels>0);
 }
@@ -800,6 +943,7 @@ void Interpreter::ClearCommand(nodeType *p) {
     int i;
 
     if (!p) return;
+    ForgetCommand(p);
     if(p->type==typeId) 
       free(p->id.i);
 
@@ -902,19 +1046,19 @@ bool Interpreter::ExecuteProcedure(nodeType *p) {
      if(pargs->opr.oper==';') {
        if(IsNumberId(pdefargs->opr.op[1]))  {
 
-         if (!IsNumberId(pargs->opr.op[1]) || m_ST.DefinedIntVar(pargs->opr.op[1]->id.i))
-             procInter.m_ST.letInt(pdefargs->opr.op[1]->id.i, ReadNumber(pargs->opr.op[1]));
+         if (!IsNumberId(pargs->opr.op[1]) || m_ST.DefinedIntVar(pargs->opr.op[1]->id.n))
+             procInter.m_ST.letInt(pdefargs->opr.op[1]->id.n, ReadNumber(pargs->opr.op[1]));
 /*         else 
-             procInter.m_ST.letInt(pdefargs->opr.op[1]->id.i, Number((unsigned int)0));*/
-          procInter.m_ST.SetAccessedIntVar(pdefargs->opr.op[1]->id.i,false);
+             procInter.m_ST.letInt(pdefargs->opr.op[1]->id.n, Number((unsigned int)0));*/
+          procInter.m_ST.SetAccessedIntVar(pdefargs->opr.op[1]->id.n,false);
          
        }
        else {
-         if (!IsBooleanId(pargs->opr.op[1]) || m_ST.DefinedBoolVar(pargs->opr.op[1]->id.i))
-           procInter.m_ST.letBool(pdefargs->opr.op[1]->id.i, ReadBoolean(pargs->opr.op[1]));
+         if (!IsBooleanId(pargs->opr.op[1]) || m_ST.DefinedBoolVar(pargs->opr.op[1]->id.n))
+           procInter.m_ST.letBool(pdefargs->opr.op[1]->id.n, ReadBoolean(pargs->opr.op[1]));
 /*         else 
-           procInter.m_ST.letBool(pdefargs->opr.op[1]->id.i, Boolean(false));*/
-         procInter.m_ST.SetAccessedBoolVar(pdefargs->opr.op[1]->id.i,false);
+           procInter.m_ST.letBool(pdefargs->opr.op[1]->id.n, Boolean(false));*/
+         procInter.m_ST.SetAccessedBoolVar(pdefargs->opr.op[1]->id.n,false);
        }
        bMoreArgs = (pargs->opr.oper==';');
        pargs = pargs->opr.op[0];
@@ -923,18 +1067,18 @@ bool Interpreter::ExecuteProcedure(nodeType *p) {
      else {
        if(IsNumberId(pdefargs))  {
 
-         if (!IsNumberId(pargs) || m_ST.DefinedIntVar(pargs->id.i)) 
-           procInter.m_ST.letInt(pdefargs->id.i, ReadNumber(pargs));
+         if (!IsNumberId(pargs) || m_ST.DefinedIntVar(pargs->id.n)) 
+           procInter.m_ST.letInt(pdefargs->id.n, ReadNumber(pargs));
 /*         else 
-           procInter.m_ST.letInt(pdefargs->id.i, Number((unsigned int)0));*/
-         procInter.m_ST.SetAccessedIntVar(pdefargs->id.i,false);
+           procInter.m_ST.letInt(pdefargs->id.n, Number((unsigned int)0));*/
+         procInter.m_ST.SetAccessedIntVar(pdefargs->id.n,false);
        }
        else {
-         if (!IsBooleanId(pargs) || m_ST.DefinedBoolVar(pargs->id.i))
-           procInter.m_ST.letBool(pdefargs->id.i, ReadBoolean(pargs));
+         if (!IsBooleanId(pargs) || m_ST.DefinedBoolVar(pargs->id.n))
+           procInter.m_ST.letBool(pdefargs->id.n, ReadBoolean(pargs));
  /*        else
-           procInter.m_ST.letBool(pdefargs->id.i, Boolean(false));*/
-         procInter.m_ST.SetAccessedBoolVar(pdefargs->id.i,false);
+           procInter.m_ST.letBool(pdefargs->id.n, Boolean(false));*/
+         procInter.m_ST.SetAccessedBoolVar(pdefargs->id.n,false);
        }
 
        bMoreArgs=false;
@@ -943,7 +1087,7 @@ bool Interpreter::ExecuteProcedure(nodeType *p) {
 
    // Executing procedure
    nodeType *pcode=it->second->opr.op[2];
-   procInter.ExecuteCommandTree(pcode);
+   procInter.Execute(pcode);
 
    // Copying arguments back
    pargs=p->opr.op[1];
@@ -954,18 +1098,18 @@ bool Interpreter::ExecuteProcedure(nodeType *p) {
      if(pargs->opr.oper==';') {      
        if(IsNumberId(pargs->opr.op[1]))  {
 
-         if (!procInter.m_ST.GetAccessedIntVar(pdefargs->opr.op[1]->id.i) && !m_ST.DefinedIntVar(pargs->opr.op[1]->id.i))
-             procInter.m_ST.letInt(pdefargs->opr.op[1]->id.i, Number((unsigned int)0));
+         if (!procInter.m_ST.GetAccessedIntVar(pdefargs->opr.op[1]->id.n) && !m_ST.DefinedIntVar(pargs->opr.op[1]->id.n))
+             procInter.m_ST.letInt(pdefargs->opr.op[1]->id.n, Number((unsigned int)0));
 
-         m_ST.letInt(pargs->opr.op[1]->id.i, procInter.ReadNumber(pdefargs->opr.op[1]));
+         m_ST.letInt(pargs->opr.op[1]->id.n, procInter.ReadNumber(pdefargs->opr.op[1]));
        }
        else 
          if(IsBooleanId(pargs->opr.op[1])) {
 
-          if (!procInter.m_ST.GetAccessedBoolVar(pdefargs->opr.op[1]->id.i) && !m_ST.DefinedBoolVar(pargs->opr.op[1]->id.i))
-             procInter.m_ST.letBool(pdefargs->opr.op[1]->id.i, Boolean(false));
+          if (!procInter.m_ST.GetAccessedBoolVar(pdefargs->opr.op[1]->id.n) && !m_ST.DefinedBoolVar(pargs->opr.op[1]->id.n))
+             procInter.m_ST.letBool(pdefargs->opr.op[1]->id.n, Boolean(false));
 
-          m_ST.letBool(pargs->opr.op[1]->id.i, procInter.ReadBoolean(pdefargs->opr.op[1]));
+          m_ST.letBool(pargs->opr.op[1]->id.n, procInter.ReadBoolean(pdefargs->opr.op[1]));
 
        }
 
@@ -976,19 +1120,19 @@ bool Interpreter::ExecuteProcedure(nodeType *p) {
      else {
        if(IsNumberId(pargs))  {
 
-         if (!procInter.m_ST.GetAccessedIntVar(pdefargs->id.i) && !m_ST.DefinedIntVar(pargs->id.i))
-             procInter.m_ST.letInt(pdefargs->id.i, Number((unsigned int)0));
+         if (!procInter.m_ST.GetAccessedIntVar(pdefargs->id.n) && !m_ST.DefinedIntVar(pargs->id.n))
+             procInter.m_ST.letInt(pdefargs->id.n, Number((unsigned int)0));
 
-         m_ST.letInt(pargs->id.i, procInter.ReadNumber(pdefargs));
+         m_ST.letInt(pargs->id.n, procInter.ReadNumber(pdefargs));
 
        }
        else  
          if(IsBooleanId(pargs)) {
 
-           if (!procInter.m_ST.GetAccessedBoolVar(pdefargs->id.i) && !m_ST.DefinedBoolVar(pargs->id.i))
-              procInter.m_ST.letBool(pdefargs->id.i, Boolean(false));
+           if (!procInter.m_ST.GetAccessedBoolVar(pdefargs->id.n) && !m_ST.DefinedBoolVar(pargs->id.n))
+              procInter.m_ST.letBool(pdefargs->id.n, Boolean(false));
 
-            m_ST.letBool(pargs->id.i, procInter.ReadBoolean(pdefargs));
+            m_ST.letBool(pargs->id.n, procInter.ReadBoolean(pdefargs));
          }
 
        bMoreArgs=false;
@@ -1002,19 +1146,6 @@ bool Interpreter::ExecuteProcedure(nodeType *p) {
 // ----------------------------------------------------------------------------
 
 
-void Interpreter::ExecuteCommandTree(nodeType *p) {
-     if(p->opr.oper==';') {
-       ExecuteCommandTree(p->opr.op[0]);
-       ExecuteCommand(p->opr.op[1]);
-     }       
-     else  
-       ExecuteCommand(p);
-}
-
-
-// ----------------------------------------------------------------------------
-
-
 int store_procedure(nodeType *p) {
    in.RecordProcedure(p);
    return 0; 
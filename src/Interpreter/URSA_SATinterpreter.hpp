@@ -21,9 +21,10 @@ GNU General Public License for more details.
 #include "Boolean.hpp"
 #include "SymbolTable.hpp"
 #include "Timer.h"
+#include "Bytecode.hpp"
 
 
-map<const string, nodeType *, lstr > URSAprocedures; 
+extern map<const string, nodeType *, lstr > URSAprocedures; 
 
 
 class Interpreter {
@@ -32,6 +33,7 @@ public:
    ~Interpreter () { m_ST.Clear(); ClearProgram(); };
 
    int ExecuteCommand(nodeType *p);
+   int Execute(nodeType *p);
    void RecordCommand(nodeType *p);
    void RecordProcedure(nodeType *p);
 
@@ -48,17 +50,38 @@ private:
 
    void PrintProcedure();
    void PrintCommand(nodeType *p);
-   void ExecuteCommandTree(nodeType *p);
+
+   // the bytecode (Bytecode.cpp)
+   Bytecode *Compile(nodeType *p, bool bInputs);
+   void NumberVars(nodeType *p, set<unsigned int>& vars);
+   void CompileCommand(nodeType *p, Bytecode& c, set<unsigned int>& ground);
+   Operand CompileNumber(nodeType *p, Bytecode& c, const set<unsigned int>& ground);
+   Operand CompileBoolean(nodeType *p, Bytecode& c, const set<unsigned int>& ground);
+   bool IsGround(nodeType *p, const set<unsigned int>& ground);
+   void GroundAfter(nodeType *p, set<unsigned int>& ground);
+   void LoopHead(nodeType *body, nodeType *step, set<unsigned int>& ground);
+   void Spill(const set<unsigned int>& vars, Bytecode& c);
+   Operand GroundConstant(unsigned long n, Bytecode& c);
+   Operand ToNumber(Operand o, Bytecode& c);
+   Operand ToBoolean(Operand o, Bytecode& c);
+   Operand ToIndex(Operand o, Bytecode& c);
+   Operand Binary(eOpcode op, eOpcode gop, eRegisterFile operands, eRegisterFile result, Operand a, Operand b, Bytecode& c);
+   Operand Unary(eOpcode op, eOpcode gop, eRegisterFile result, Operand a, Bytecode& c);
+   unsigned int JumpIfNot(Operand r, Bytecode& c);
+   bool Run(const Bytecode& c);
+   void ForgetCommand(nodeType *p);
 
    // for optimization problems 
    void setLimits(nodeType *p, const Number& min, const Number& max, bool bMax);
-   unsigned int nMin, nMax, nOptimalCandidate;
+   unsigned long nMin, nMax, nOptimalCandidate;
    bool bMaximize; 
    string sOptimizationVarName;
+   unsigned int nOptimizationVarId;
    nodeType *pOptimizationConstraint;
 
    Number ReadNumber(nodeType *p);
    Boolean ReadBoolean(nodeType *p);
+   void ReadBooleanList(nodeType *p, vector<Boolean>& b, vector<Number>* w);
    bool IsNumberId(nodeType *p);
    bool IsBooleanId(nodeType *p);
 
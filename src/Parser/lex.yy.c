@@ -0,0 +1,62 @@
+// Hand-written stand-in for the flex-generated scanner (local testing only).
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include "ursa.h"
+#include "ursa.tab.hpp"
+void yyerror(char *);
+FILE* yyin = NULL;
+static int peekc() { if(!yyin) yyin=stdin; int c=getc(yyin); if(c!=EOF) ungetc(c,yyin); return c; }
+static int getch() { if(!yyin) yyin=stdin; return getc(yyin); }
+struct KW { const char* s; int t; };
+static KW kws[] = {
+ {"num2bool",NUM2BOOL},{"bool2num",BOOL2NUM},{"sgn",SGN},{"ite",ITE},{"while",WHILE},{"for",FOR},{"if",IF},{"else",ELSE},
+ {"print",PRINT},{"printb",PRINTB},{"printx",PRINTX},{"listvars",LIST},{"clear",CLEAR},{"halt",HALT},{"minimize",MINIMIZE},
+ {"maximize",MAXIMIZE},{"assert",ASSERT},{"assert_all",ASSERTA},{"procedure",PROCEDURE},{"call",CALL},
+#include "/tmp/lexer/extra_kw.inc"
+ {0,0}};
+struct OP { const char* s; int t; };
+static OP ops[] = {
+ {"<<=",LSHIFTEQ},{">>=",RSHIFTEQ},{"&&=",ANDEQ},{"||=",OREQ},{"^^=",XOREQ},
+ {"++",PLUSPLUS},{"--",MINUSMINUS},{"+=",PLUSEQ},{"-=",MINUSEQ},{"*=",MULTEQ},{"/=",DIVEQ},{"%=",MODEQ},{"&=",BITWISEANDEQ},{"|=",BITWISEOREQ},{"^=",BITWISEXOREQ},
+ {"&&",LOGICALAND},{"||",LOGICALOR},{"^^",LOGICALXOR},{"<<",LSHIFT},{">>",RSHIFT},{">=",GE},{"<=",LE},{"==",EQ},{"!=",NE},{0,0}};
+int yylex(void) {
+  for(;;) {
+    int c = getch();
+    if (c==EOF) return 0;
+    if (c==' '||c=='\t'||c=='\n'||c=='\r') continue;
+    if (c=='/' && peekc()=='*') { getch(); int p=0; for(;;){ int d=getch(); if(d==EOF) return 0; if(p=='*'&&d=='/') break; p=d;} continue; }
+    if (isalpha(c)) {
+      std::string w(1,(char)c);
+      while (isalnum(peekc())||peekc()=='_') w+=(char)getch();
+      for (KW* k=kws;k->s;k++) if (w==k->s) return k->t;
+      if (w=="true") { yylval.bValue=1; return BOOLEAN; }
+      if (w=="false") { yylval.bValue=0; return BOOLEAN; }
+      yylval.sName = strdup(w.c_str());
+      if (w[0]=='n') return INTEGER_VARIABLE;
+      if (w[0]=='b') return BOOLEAN_VARIABLE;
+      return PROCEDURE_ID;
+    }
+    if (isdigit(c)) {
+      std::string w(1,(char)c);
+      if (c=='0' && (peekc()=='x'||peekc()=='b')) {
+        int m=getch(); w+=(char)m;
+        while (m=='x' ? isxdigit(peekc()) : (peekc()=='0'||peekc()=='1')) w+=(char)getch();
+      } else while (isdigit(peekc())) w+=(char)getch();
+      yylval.sValue = strdup(w.c_str()); return INTEGER;
+    }
+    char buf[4]={(char)c,0,0,0};
+    int n1=peekc();
+    for (OP* o=ops;o->s;o++) {
+      size_t l=strlen(o->s);
+      if (o->s[0]!=c) continue;
+      if (l==2 && o->s[1]==n1) { getch(); if (o->t==LSHIFT||o->t==RSHIFT||o->t==LOGICALAND||o->t==LOGICALOR||o->t==LOGICALXOR) { if (peekc()=='=') { getch(); for(OP* q=ops;q->s;q++) if(strlen(q->s)==3&&q->s[0]==c) return q->t; } } return o->t; }
+    }
+    (void)buf;
+    if (strchr("-()<>=+*/%;{}.,|&^~[]!", c)) return c;
+    yyerror((char*)"Unknown character");
+  }
+}
+int yywrap(void) { return 1; }
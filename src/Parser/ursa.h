@@ -16,6 +16,7 @@ typedef struct {
 /* identifiers */
 typedef struct {
     char* i;                    /* var name */
+    unsigned int n;             /* interned id of the name */
 } idNodeType;
 
 /* operators */
@@ -38,5 +39,8 @@ typedef struct nodeTypeTag {
     };
 } nodeType;
 
+/* the id of a variable name in the symbol tables */
+unsigned int intern(const char* i);
+
 
 #endif
@@ -0,0 +1,2750 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "Parser/ursa.ypp"
+
+#define YYDEBUG 1
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "ursa.h"
+
+/* prototypes */
+nodeType *opr(int oper, int nops, ...);
+nodeType *id(char* i);
+nodeType *intConst(char* value);
+nodeType *boolConst(bool value);
+void freeNode(nodeType *p);
+int ex(nodeType *p);
+int store_procedure(nodeType *p);
+int yylex(void);
+
+void yyerror(char *s);
+
+#line 92 "ursa.tab.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "ursa.tab.hpp"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_BOOLEAN = 4,                    /* BOOLEAN  */
+  YYSYMBOL_BOOLEAN_VARIABLE = 5,           /* BOOLEAN_VARIABLE  */
+  YYSYMBOL_INTEGER_VARIABLE = 6,           /* INTEGER_VARIABLE  */
+  YYSYMBOL_BOOLEAN_ARRAY = 7,              /* BOOLEAN_ARRAY  */
+  YYSYMBOL_INTEGER_ARRAY = 8,              /* INTEGER_ARRAY  */
+  YYSYMBOL_PROCEDURE_ID = 9,               /* PROCEDURE_ID  */
+  YYSYMBOL_FOR = 10,                       /* FOR  */
+  YYSYMBOL_WHILE = 11,                     /* WHILE  */
+  YYSYMBOL_IF = 12,                        /* IF  */
+  YYSYMBOL_PRINT = 13,                     /* PRINT  */
+  YYSYMBOL_PRINTB = 14,                    /* PRINTB  */
+  YYSYMBOL_PRINTX = 15,                    /* PRINTX  */
+  YYSYMBOL_MINIMIZE = 16,                  /* MINIMIZE  */
+  YYSYMBOL_MAXIMIZE = 17,                  /* MAXIMIZE  */
+  YYSYMBOL_ASSERT = 18,                    /* ASSERT  */
+  YYSYMBOL_ASSERTA = 19,                   /* ASSERTA  */
+  YYSYMBOL_LIST = 20,                      /* LIST  */
+  YYSYMBOL_CLEAR = 21,                     /* CLEAR  */
+  YYSYMBOL_HALT = 22,                      /* HALT  */
+  YYSYMBOL_PROCEDURE = 23,                 /* PROCEDURE  */
+  YYSYMBOL_CALL = 24,                      /* CALL  */
+  YYSYMBOL_WIDTH = 25,                     /* WIDTH  */
+  YYSYMBOL_SWIDTH = 26,                    /* SWIDTH  */
+  YYSYMBOL_IFX = 27,                       /* IFX  */
+  YYSYMBOL_ELSE = 28,                      /* ELSE  */
+  YYSYMBOL_PLUSEQ = 29,                    /* PLUSEQ  */
+  YYSYMBOL_MINUSEQ = 30,                   /* MINUSEQ  */
+  YYSYMBOL_MULTEQ = 31,                    /* MULTEQ  */
+  YYSYMBOL_DIVEQ = 32,                     /* DIVEQ  */
+  YYSYMBOL_MODEQ = 33,                     /* MODEQ  */
+  YYSYMBOL_ANDEQ = 34,                     /* ANDEQ  */
+  YYSYMBOL_OREQ = 35,                      /* OREQ  */
+  YYSYMBOL_XOREQ = 36,                     /* XOREQ  */
+  YYSYMBOL_LSHIFTEQ = 37,                  /* LSHIFTEQ  */
+  YYSYMBOL_RSHIFTEQ = 38,                  /* RSHIFTEQ  */
+  YYSYMBOL_BITWISEANDEQ = 39,              /* BITWISEANDEQ  */
+  YYSYMBOL_BITWISEOREQ = 40,               /* BITWISEOREQ  */
+  YYSYMBOL_BITWISEXOREQ = 41,              /* BITWISEXOREQ  */
+  YYSYMBOL_LOGICALXOR = 42,                /* LOGICALXOR  */
+  YYSYMBOL_LOGICALOR = 43,                 /* LOGICALOR  */
+  YYSYMBOL_LOGICALAND = 44,                /* LOGICALAND  */
+  YYSYMBOL_45_ = 45,                       /* '|'  */
+  YYSYMBOL_46_ = 46,                       /* '^'  */
+  YYSYMBOL_47_ = 47,                       /* '&'  */
+  YYSYMBOL_48_ = 48,                       /* '>'  */
+  YYSYMBOL_49_ = 49,                       /* '<'  */
+  YYSYMBOL_GE = 50,                        /* GE  */
+  YYSYMBOL_LE = 51,                        /* LE  */
+  YYSYMBOL_EQ = 52,                        /* EQ  */
+  YYSYMBOL_NE = 53,                        /* NE  */
+  YYSYMBOL_LSHIFT = 54,                    /* LSHIFT  */
+  YYSYMBOL_RSHIFT = 55,                    /* RSHIFT  */
+  YYSYMBOL_56_ = 56,                       /* '+'  */
+  YYSYMBOL_57_ = 57,                       /* '-'  */
+  YYSYMBOL_58_ = 58,                       /* '*'  */
+  YYSYMBOL_59_ = 59,                       /* '/'  */
+  YYSYMBOL_60_ = 60,                       /* '%'  */
+  YYSYMBOL_61_ = 61,                       /* '!'  */
+  YYSYMBOL_PLUSPLUS = 62,                  /* PLUSPLUS  */
+  YYSYMBOL_MINUSMINUS = 63,                /* MINUSMINUS  */
+  YYSYMBOL_UMINUS = 64,                    /* UMINUS  */
+  YYSYMBOL_65_ = 65,                       /* '~'  */
+  YYSYMBOL_ITE = 66,                       /* ITE  */
+  YYSYMBOL_BOOL2NUM = 67,                  /* BOOL2NUM  */
+  YYSYMBOL_NUM2BOOL = 68,                  /* NUM2BOOL  */
+  YYSYMBOL_SGN = 69,                       /* SGN  */
+  YYSYMBOL_ATMOST = 70,                    /* ATMOST  */
+  YYSYMBOL_ATLEAST = 71,                   /* ATLEAST  */
+  YYSYMBOL_EXACTLY = 72,                   /* EXACTLY  */
+  YYSYMBOL_PB_LE = 73,                     /* PB_LE  */
+  YYSYMBOL_SLT = 74,                       /* SLT  */
+  YYSYMBOL_SGT = 75,                       /* SGT  */
+  YYSYMBOL_SLE = 76,                       /* SLE  */
+  YYSYMBOL_SGE = 77,                       /* SGE  */
+  YYSYMBOL_78_ = 78,                       /* '('  */
+  YYSYMBOL_79_ = 79,                       /* ')'  */
+  YYSYMBOL_80_ = 80,                       /* '{'  */
+  YYSYMBOL_81_ = 81,                       /* '}'  */
+  YYSYMBOL_82_ = 82,                       /* ','  */
+  YYSYMBOL_83_ = 83,                       /* ';'  */
+  YYSYMBOL_84_ = 84,                       /* '='  */
+  YYSYMBOL_85_ = 85,                       /* '['  */
+  YYSYMBOL_86_ = 86,                       /* ']'  */
+  YYSYMBOL_87_ = 87,                       /* '.'  */
+  YYSYMBOL_YYACCEPT = 88,                  /* $accept  */
+  YYSYMBOL_program = 89,                   /* program  */
+  YYSYMBOL_procedure_list = 90,            /* procedure_list  */
+  YYSYMBOL_procedure = 91,                 /* procedure  */
+  YYSYMBOL_form_arg_list = 92,             /* form_arg_list  */
+  YYSYMBOL_form_arg = 93,                  /* form_arg  */
+  YYSYMBOL_arg_list = 94,                  /* arg_list  */
+  YYSYMBOL_arg = 95,                       /* arg  */
+  YYSYMBOL_main = 96,                      /* main  */
+  YYSYMBOL_stmt = 97,                      /* stmt  */
+  YYSYMBOL_single_stmt = 98,               /* single_stmt  */
+  YYSYMBOL_comp_stmt = 99,                 /* comp_stmt  */
+  YYSYMBOL_stmt_list = 100,                /* stmt_list  */
+  YYSYMBOL_constraint_list = 101,          /* constraint_list  */
+  YYSYMBOL_expr = 102,                     /* expr  */
+  YYSYMBOL_bool_expr = 103,                /* bool_expr  */
+  YYSYMBOL_bool_list = 104,                /* bool_list  */
+  YYSYMBOL_bool_item = 105,                /* bool_item  */
+  YYSYMBOL_pb_list = 106                   /* pb_list  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  7
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1262
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  88
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  19
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  145
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  391
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   320
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    61,     2,     2,     2,    60,    47,     2,
+      78,    79,    58,    56,    82,    57,    87,    59,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    83,
+      49,    84,    48,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    85,     2,    86,    46,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    80,    45,    81,    65,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      50,    51,    52,    53,    54,    55,    62,    63,    64,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    63,    63,    64,    68,    69,    73,    77,    78,    82,
+      83,    87,    88,    92,    93,    98,    99,   104,   105,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   125,   126,   127,   129,   130,   131,
+     133,   134,   135,   137,   138,   139,   141,   142,   143,   145,
+     146,   147,   149,   150,   151,   153,   154,   155,   157,   158,
+     159,   161,   162,   163,   165,   166,   167,   169,   170,   171,
+     173,   174,   175,   177,   178,   179,   181,   182,   183,   185,
+     186,   187,   189,   190,   191,   195,   196,   197,   198,   199,
+     203,   204,   209,   210,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   237,   238,   239,   240,   241,   242,
+     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,   255,   256,   257,   258,   259,   260,   261,   266,
+     267,   271,   272,   273,   278,   279
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "INTEGER", "BOOLEAN",
+  "BOOLEAN_VARIABLE", "INTEGER_VARIABLE", "BOOLEAN_ARRAY", "INTEGER_ARRAY",
+  "PROCEDURE_ID", "FOR", "WHILE", "IF", "PRINT", "PRINTB", "PRINTX",
+  "MINIMIZE", "MAXIMIZE", "ASSERT", "ASSERTA", "LIST", "CLEAR", "HALT",
+  "PROCEDURE", "CALL", "WIDTH", "SWIDTH", "IFX", "ELSE", "PLUSEQ",
+  "MINUSEQ", "MULTEQ", "DIVEQ", "MODEQ", "ANDEQ", "OREQ", "XOREQ",
+  "LSHIFTEQ", "RSHIFTEQ", "BITWISEANDEQ", "BITWISEOREQ", "BITWISEXOREQ",
+  "LOGICALXOR", "LOGICALOR", "LOGICALAND", "'|'", "'^'", "'&'", "'>'",
+  "'<'", "GE", "LE", "EQ", "NE", "LSHIFT", "RSHIFT", "'+'", "'-'", "'*'",
+  "'/'", "'%'", "'!'", "PLUSPLUS", "MINUSMINUS", "UMINUS", "'~'", "ITE",
+  "BOOL2NUM", "NUM2BOOL", "SGN", "ATMOST", "ATLEAST", "EXACTLY", "PB_LE",
+  "SLT", "SGT", "SLE", "SGE", "'('", "')'", "'{'", "'}'", "','", "';'",
+  "'='", "'['", "']'", "'.'", "$accept", "program", "procedure_list",
+  "procedure", "form_arg_list", "form_arg", "arg_list", "arg", "main",
+  "stmt", "single_stmt", "comp_stmt", "stmt_list", "constraint_list",
+  "expr", "bool_expr", "bool_list", "bool_item", "pb_list", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-316)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+      12,    68,     6,    12,  -316,   364,   -32,  -316,  -316,   364,
+     -17,   161,    14,    26,    30,   393,   285,   285,    41,    66,
+      70,    73,  -316,  -316,  -316,   171,    84,   104,   364,  -316,
+    -316,   114,  -316,     8,   393,   393,   393,   393,   285,   285,
+     285,   285,   285,   285,   285,   285,   285,   285,   285,  -316,
+    -316,   285,   285,    37,   393,   393,  -316,  -316,   126,   146,
+     285,   393,   285,   159,   160,   172,   178,   189,   220,   221,
+     222,   224,   226,   229,   230,   393,  1187,    95,   231,   285,
+     897,   897,   269,   299,   393,   393,   233,   306,   307,  -316,
+      69,  -316,  -316,  -316,   -75,  -316,  1187,    95,    95,    95,
+      95,   498,   897,   897,   897,   897,   897,   897,   897,   897,
+     897,   897,   897,   514,   235,    -3,   215,   285,   285,  -316,
+    -316,  -316,   393,   393,   285,   285,   285,   285,   285,   285,
+     285,   285,   285,   285,   919,   227,   285,   285,   285,   285,
+     285,   285,   285,   285,   285,   285,   285,   285,   285,   285,
+     285,   285,   393,   393,   393,   393,   935,   232,   249,   -45,
+      95,   -35,   393,   250,   252,  -316,  -316,   239,     8,   -14,
+     371,   393,   364,   364,   531,   547,   -33,   238,   961,   977,
+     667,   705,   721,   737,   753,   769,   785,   801,  -316,  -316,
+    1202,   129,   302,   897,   897,   897,   897,   897,   897,    97,
+      97,   237,   237,  -316,  -316,  -316,    29,   291,  -316,    63,
+     285,   285,  -316,   393,  -316,   -67,  -316,  1187,    95,   285,
+     285,   364,  -316,   393,   393,   393,   393,   285,   285,   285,
+     285,   285,   285,   285,   285,   285,   285,   285,  -316,  -316,
+     285,   285,    57,  -316,   308,   253,   254,   393,  -316,  -316,
+    -316,   417,   417,   417,   285,   285,   285,   285,   285,   285,
+     817,   833,    95,  -316,   393,  1003,  1019,   153,    95,    95,
+      95,    95,   564,   897,   897,   897,   897,   897,   897,   897,
+     897,   897,   897,   897,   580,    37,   364,   285,   285,   688,
+      99,   255,    95,   -13,  -316,   124,   128,   849,   197,  1045,
+    1061,  1087,  1103,   865,   285,   285,  -316,  -316,  -316,  -316,
+      62,   467,   262,  -316,   597,   613,   285,   393,   285,  -316,
+     417,  -316,  -316,   417,  -316,   285,  -316,  -316,  -316,  -316,
+    1129,  1145,   393,   393,   393,   393,   285,   285,   285,   285,
+     285,   285,   285,   285,   285,   285,  -316,  -316,   285,   364,
+    -316,  -316,  1171,   241,   206,  -316,  -316,   881,  -316,  -316,
+      95,    95,    95,    95,   897,   897,   897,   897,   897,   897,
+     897,   897,   897,   897,   897,  -316,  -316,  -316,   258,   257,
+     417,   285,   285,  -316,   477,   630,   266,  -316,   285,   646,
+    -316
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+      16,     0,     0,    16,     4,     3,     0,     1,     5,     2,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    21,    22,    23,     0,     0,     0,     0,    19,
+      15,     0,    18,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    37,
+      40,     0,     0,     0,     0,     0,    94,   114,   115,    95,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    24,    27,     0,     0,
+      25,    26,     0,     0,     0,     0,     0,     0,     0,    90,
+       0,    17,    10,     9,     0,     7,     0,    76,    79,    82,
+      73,     0,    43,    46,    49,    52,    55,    67,    70,    58,
+      61,    64,    34,     0,     0,     0,     0,     0,     0,    98,
+     121,   112,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      92,     0,     0,     0,     0,    89,    91,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   113,   138,
+     107,   108,   106,   123,   122,   124,   125,   127,   126,    99,
+     100,   101,   102,   103,   104,   105,   120,   119,   118,     0,
+       0,     0,    32,     0,    33,     0,    11,    13,    14,     0,
+       0,     0,     8,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    38,    41,
+       0,     0,     0,    85,    87,   116,    96,     0,   110,   129,
+     111,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    93,    20,     0,     0,     0,     0,    77,    80,
+      83,    74,     0,    44,    47,    50,    53,    56,    68,    71,
+      59,    62,    65,    35,     0,     0,     0,     0,     0,     0,
+       0,   115,   141,     0,   139,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    12,    30,    31,     6,
+       0,     0,     0,    88,     0,     0,     0,     0,     0,   134,
+       0,   135,   136,     0,   137,     0,   130,   131,   132,   133,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    39,    42,     0,     0,
+     117,    97,     0,     0,     0,   140,   144,     0,    28,    29,
+      78,    81,    84,    75,    45,    48,    51,    54,    57,    69,
+      72,    60,    63,    66,    36,    86,   109,   128,   116,     0,
+       0,     0,     0,   145,     0,     0,     0,   142,     0,     0,
+     143
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -316,  -316,  -316,   346,  -316,   200,  -316,   101,   368,   -12,
+     -50,  -316,   151,   309,   -15,   193,    34,  -315,  -316
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     2,     3,     4,    94,    95,   215,   216,     5,    30,
+      31,    32,    90,   159,    96,   292,   293,   294,   298
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      76,    80,    81,   114,   167,   355,     7,   168,   356,   152,
+     153,   154,   263,    92,    93,   264,    89,    34,    35,    36,
+     223,   224,   225,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   212,     1,   112,   113,   213,   152,
+     153,   154,    10,    11,   214,   119,    33,   121,   213,   247,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+     134,    25,    26,    27,   156,   383,   319,    37,    38,   320,
+     226,   227,   153,   154,    10,    11,   172,     6,   166,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    53,    25,    26,    27,   332,   333,   334,   152,
+     153,   154,   174,   175,    54,   152,   153,   154,    55,   178,
+     179,   180,   181,   182,   183,   184,   185,   186,   187,    82,
+      29,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   152,   153,   154,
+     285,   152,   153,   154,    83,   259,   335,   217,    84,    28,
+     165,    85,    29,   147,   148,   149,   150,   151,    10,    11,
+     243,   244,    87,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,   138,    25,    26,    27,
+      86,   317,    88,   145,   146,   147,   148,   149,   150,   151,
+      39,    40,    41,    42,    43,   260,   261,    91,    44,    45,
+      46,    47,    48,   321,   265,   266,   320,   322,    77,    89,
+     320,   117,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,    49,    50,   283,   284,    97,    98,    99,
+     100,   118,   289,    28,   309,   312,    29,   122,   123,   297,
+     299,   300,   301,   302,   303,    51,    52,   115,   116,   217,
+     124,   136,   137,   138,   120,   166,   125,   152,   153,   154,
+     145,   146,   147,   148,   149,   150,   151,   126,   135,   152,
+     153,   154,   314,   315,   313,   157,   324,   160,   160,   325,
+     152,   153,   154,   152,   153,   154,   295,   296,    56,   330,
+     331,    59,   378,   379,   173,   149,   150,   151,   127,   128,
+     129,   352,   130,   354,   131,   158,   189,   132,   133,   155,
+     357,   162,   163,   164,   210,   176,   177,   248,   171,   221,
+     377,   364,   365,   366,   367,   368,   369,   370,   371,   372,
+     373,   211,   219,   374,   220,   154,   286,   375,   287,   288,
+     318,   349,    60,   381,   382,   206,   207,   208,   209,     8,
+      62,    78,    64,   388,    66,   218,   145,   146,   147,   148,
+     149,   150,   151,    79,   242,   306,   384,   385,   222,    10,
+      11,     9,   267,   389,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,     0,    25,    26,
+      27,     0,     0,     0,   161,     0,    56,    57,    58,    59,
+     228,   229,   230,   231,   232,     0,   262,     0,   233,   234,
+     235,   236,   237,     0,     0,     0,   268,   269,   270,   271,
+      56,    57,   291,    59,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   238,   239,     0,     0,     0,     0,     0,
+     290,     0,     0,     0,    28,     0,     0,    29,     0,     0,
+      60,     0,     0,     0,    61,   240,   241,   218,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,     0,     0,    60,     0,     0,     0,    61,     0,
+       0,     0,    62,    63,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,   336,   337,   338,   339,
+     340,     0,     0,     0,   341,   342,   343,   344,   345,     0,
+     353,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   136,   137,   138,   360,   361,   362,   363,   346,
+     347,   145,   146,   147,   148,   149,   150,   151,     0,     0,
+       0,     0,     0,   136,   137,   138,     0,     0,     0,     0,
+       0,   348,   145,   146,   147,   148,   149,   150,   151,   136,
+     137,   138,     0,   350,   386,     0,     0,     0,   145,   146,
+     147,   148,   149,   150,   151,     0,   136,   137,   138,     0,
+       0,     0,     0,     0,   169,   145,   146,   147,   148,   149,
+     150,   151,   136,   137,   138,     0,     0,     0,     0,     0,
+     170,   145,   146,   147,   148,   149,   150,   151,     0,   136,
+     137,   138,     0,     0,     0,     0,     0,   245,   145,   146,
+     147,   148,   149,   150,   151,   136,   137,   138,     0,     0,
+       0,     0,     0,   246,   145,   146,   147,   148,   149,   150,
+     151,     0,   136,   137,   138,     0,     0,     0,     0,     0,
+     310,   145,   146,   147,   148,   149,   150,   151,   136,   137,
+     138,     0,     0,     0,     0,     0,   311,   145,   146,   147,
+     148,   149,   150,   151,     0,   136,   137,   138,     0,     0,
+       0,     0,     0,   350,   145,   146,   147,   148,   149,   150,
+     151,   136,   137,   138,     0,     0,     0,     0,     0,   351,
+     145,   146,   147,   148,   149,   150,   151,     0,     0,     0,
+       0,     0,   136,   137,   138,     0,   387,     0,     0,     0,
+       0,   145,   146,   147,   148,   149,   150,   151,     0,     0,
+       0,     0,   390,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   251,
+     136,   137,   138,     0,     0,     0,     0,     0,     0,   145,
+     146,   147,   148,   149,   150,   151,   136,   137,   138,     0,
+     316,     0,     0,     0,     0,   145,   146,   147,   148,   149,
+     150,   151,   136,   137,   138,     0,     0,   252,     0,     0,
+       0,   145,   146,   147,   148,   149,   150,   151,   136,   137,
+     138,     0,     0,   253,     0,     0,     0,   145,   146,   147,
+     148,   149,   150,   151,   136,   137,   138,     0,     0,   254,
+       0,     0,     0,   145,   146,   147,   148,   149,   150,   151,
+     136,   137,   138,     0,     0,   255,     0,     0,     0,   145,
+     146,   147,   148,   149,   150,   151,   136,   137,   138,     0,
+       0,   256,     0,     0,     0,   145,   146,   147,   148,   149,
+     150,   151,   136,   137,   138,     0,     0,   257,     0,     0,
+       0,   145,   146,   147,   148,   149,   150,   151,   136,   137,
+     138,     0,     0,   258,     0,     0,     0,   145,   146,   147,
+     148,   149,   150,   151,   136,   137,   138,     0,     0,   304,
+       0,     0,     0,   145,   146,   147,   148,   149,   150,   151,
+     136,   137,   138,     0,     0,   305,     0,     0,     0,   145,
+     146,   147,   148,   149,   150,   151,   136,   137,   138,     0,
+       0,   323,     0,     0,     0,   145,   146,   147,   148,   149,
+     150,   151,   136,   137,   138,     0,     0,   316,     0,     0,
+       0,   145,   146,   147,   148,   149,   150,   151,     0,     0,
+       0,     0,     0,   380,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     136,   137,   138,     0,     0,     0,     0,     0,     0,   145,
+     146,   147,   148,   149,   150,   151,     0,     0,   188,     0,
+       0,     0,     0,     0,     0,     0,   136,   137,   138,     0,
+       0,     0,     0,     0,   188,   145,   146,   147,   148,   149,
+     150,   151,   136,   137,   138,     0,     0,     0,     0,     0,
+       0,   145,   146,   147,   148,   149,   150,   151,     0,     0,
+     249,     0,     0,     0,     0,     0,     0,     0,   136,   137,
+     138,     0,     0,     0,     0,     0,   250,   145,   146,   147,
+     148,   149,   150,   151,   136,   137,   138,     0,     0,     0,
+       0,     0,     0,   145,   146,   147,   148,   149,   150,   151,
+       0,     0,   307,     0,     0,     0,     0,     0,     0,     0,
+     136,   137,   138,     0,     0,     0,     0,     0,   308,   145,
+     146,   147,   148,   149,   150,   151,   136,   137,   138,     0,
+       0,     0,     0,     0,     0,   145,   146,   147,   148,   149,
+     150,   151,     0,     0,   326,     0,     0,     0,     0,     0,
+       0,     0,   136,   137,   138,     0,     0,     0,     0,     0,
+     327,   145,   146,   147,   148,   149,   150,   151,   136,   137,
+     138,     0,     0,     0,     0,     0,     0,   145,   146,   147,
+     148,   149,   150,   151,     0,     0,   328,     0,     0,     0,
+       0,     0,     0,     0,   136,   137,   138,     0,     0,     0,
+       0,     0,   329,   145,   146,   147,   148,   149,   150,   151,
+     136,   137,   138,     0,     0,     0,     0,     0,     0,   145,
+     146,   147,   148,   149,   150,   151,     0,     0,   358,     0,
+       0,     0,     0,     0,     0,     0,   136,   137,   138,     0,
+       0,     0,     0,     0,   359,   145,   146,   147,   148,   149,
+     150,   151,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   137,   138,
+     376,     0,     0,     0,     0,     0,   145,   146,   147,   148,
+     149,   150,   151
+};
+
+static const yytype_int16 yycheck[] =
+{
+      15,    16,    17,    53,    79,   320,     0,    82,   323,    42,
+      43,    44,    79,     5,     6,    82,    28,    34,    35,    36,
+      34,    35,    36,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    79,    23,    51,    52,    83,    42,
+      43,    44,     5,     6,    79,    60,    78,    62,    83,    82,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      75,    24,    25,    26,    79,   380,    79,    84,    85,    82,
+      84,    85,    43,    44,     5,     6,    79,     9,    90,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    78,    24,    25,    26,    34,    35,    36,    42,
+      43,    44,   117,   118,    78,    42,    43,    44,    78,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,    78,
+      83,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,    42,    43,    44,
+      83,    42,    43,    44,    78,    82,    84,   162,    78,    80,
+      81,    78,    83,    56,    57,    58,    59,    60,     5,     6,
+     172,   173,    78,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    47,    24,    25,    26,
+       9,    82,    78,    54,    55,    56,    57,    58,    59,    60,
+      29,    30,    31,    32,    33,   210,   211,    83,    37,    38,
+      39,    40,    41,    79,   219,   220,    82,    79,    15,   221,
+      82,    85,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,    62,    63,   240,   241,    34,    35,    36,
+      37,    85,   247,    80,    81,   285,    83,    78,    78,   254,
+     255,   256,   257,   258,   259,    84,    85,    54,    55,   264,
+      78,    45,    46,    47,    61,   267,    78,    42,    43,    44,
+      54,    55,    56,    57,    58,    59,    60,    78,    75,    42,
+      43,    44,   287,   288,   286,     6,    79,    84,    85,    82,
+      42,    43,    44,    42,    43,    44,   252,   253,     3,   304,
+     305,     6,    86,    87,    79,    58,    59,    60,    78,    78,
+      78,   316,    78,   318,    78,     6,    79,    78,    78,    78,
+     325,    78,     6,     6,    82,   122,   123,    79,    83,    80,
+      79,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,    82,    82,   348,    82,    44,    28,   349,    85,    85,
+      85,    79,    57,    85,    87,   152,   153,   154,   155,     3,
+      65,    66,    67,    87,    69,   162,    54,    55,    56,    57,
+      58,    59,    60,    78,   171,   264,   381,   382,   168,     5,
+       6,     3,   221,   388,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    -1,    24,    25,
+      26,    -1,    -1,    -1,    85,    -1,     3,     4,     5,     6,
+      29,    30,    31,    32,    33,    -1,   213,    -1,    37,    38,
+      39,    40,    41,    -1,    -1,    -1,   223,   224,   225,   226,
+       3,     4,     5,     6,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    62,    63,    -1,    -1,    -1,    -1,    -1,
+     247,    -1,    -1,    -1,    80,    -1,    -1,    83,    -1,    -1,
+      57,    -1,    -1,    -1,    61,    84,    85,   264,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    -1,    -1,    57,    -1,    -1,    -1,    61,    -1,
+      -1,    -1,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    29,    30,    31,    32,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,
+     317,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    46,    47,   332,   333,   334,   335,    62,
+      63,    54,    55,    56,    57,    58,    59,    60,    -1,    -1,
+      -1,    -1,    -1,    45,    46,    47,    -1,    -1,    -1,    -1,
+      -1,    84,    54,    55,    56,    57,    58,    59,    60,    45,
+      46,    47,    -1,    86,    87,    -1,    -1,    -1,    54,    55,
+      56,    57,    58,    59,    60,    -1,    45,    46,    47,    -1,
+      -1,    -1,    -1,    -1,    86,    54,    55,    56,    57,    58,
+      59,    60,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      86,    54,    55,    56,    57,    58,    59,    60,    -1,    45,
+      46,    47,    -1,    -1,    -1,    -1,    -1,    86,    54,    55,
+      56,    57,    58,    59,    60,    45,    46,    47,    -1,    -1,
+      -1,    -1,    -1,    86,    54,    55,    56,    57,    58,    59,
+      60,    -1,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      86,    54,    55,    56,    57,    58,    59,    60,    45,    46,
+      47,    -1,    -1,    -1,    -1,    -1,    86,    54,    55,    56,
+      57,    58,    59,    60,    -1,    45,    46,    47,    -1,    -1,
+      -1,    -1,    -1,    86,    54,    55,    56,    57,    58,    59,
+      60,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,    86,
+      54,    55,    56,    57,    58,    59,    60,    -1,    -1,    -1,
+      -1,    -1,    45,    46,    47,    -1,    86,    -1,    -1,    -1,
+      -1,    54,    55,    56,    57,    58,    59,    60,    -1,    -1,
+      -1,    -1,    86,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    82,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      55,    56,    57,    58,    59,    60,    45,    46,    47,    -1,
+      82,    -1,    -1,    -1,    -1,    54,    55,    56,    57,    58,
+      59,    60,    45,    46,    47,    -1,    -1,    82,    -1,    -1,
+      -1,    54,    55,    56,    57,    58,    59,    60,    45,    46,
+      47,    -1,    -1,    82,    -1,    -1,    -1,    54,    55,    56,
+      57,    58,    59,    60,    45,    46,    47,    -1,    -1,    82,
+      -1,    -1,    -1,    54,    55,    56,    57,    58,    59,    60,
+      45,    46,    47,    -1,    -1,    82,    -1,    -1,    -1,    54,
+      55,    56,    57,    58,    59,    60,    45,    46,    47,    -1,
+      -1,    82,    -1,    -1,    -1,    54,    55,    56,    57,    58,
+      59,    60,    45,    46,    47,    -1,    -1,    82,    -1,    -1,
+      -1,    54,    55,    56,    57,    58,    59,    60,    45,    46,
+      47,    -1,    -1,    82,    -1,    -1,    -1,    54,    55,    56,
+      57,    58,    59,    60,    45,    46,    47,    -1,    -1,    82,
+      -1,    -1,    -1,    54,    55,    56,    57,    58,    59,    60,
+      45,    46,    47,    -1,    -1,    82,    -1,    -1,    -1,    54,
+      55,    56,    57,    58,    59,    60,    45,    46,    47,    -1,
+      -1,    82,    -1,    -1,    -1,    54,    55,    56,    57,    58,
+      59,    60,    45,    46,    47,    -1,    -1,    82,    -1,    -1,
+      -1,    54,    55,    56,    57,    58,    59,    60,    -1,    -1,
+      -1,    -1,    -1,    82,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      55,    56,    57,    58,    59,    60,    -1,    -1,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    46,    47,    -1,
+      -1,    -1,    -1,    -1,    79,    54,    55,    56,    57,    58,
+      59,    60,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      -1,    54,    55,    56,    57,    58,    59,    60,    -1,    -1,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    46,
+      47,    -1,    -1,    -1,    -1,    -1,    79,    54,    55,    56,
+      57,    58,    59,    60,    45,    46,    47,    -1,    -1,    -1,
+      -1,    -1,    -1,    54,    55,    56,    57,    58,    59,    60,
+      -1,    -1,    79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    79,    54,
+      55,    56,    57,    58,    59,    60,    45,    46,    47,    -1,
+      -1,    -1,    -1,    -1,    -1,    54,    55,    56,    57,    58,
+      59,    60,    -1,    -1,    79,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      79,    54,    55,    56,    57,    58,    59,    60,    45,    46,
+      47,    -1,    -1,    -1,    -1,    -1,    -1,    54,    55,    56,
+      57,    58,    59,    60,    -1,    -1,    79,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    46,    47,    -1,    -1,    -1,
+      -1,    -1,    79,    54,    55,    56,    57,    58,    59,    60,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      55,    56,    57,    58,    59,    60,    -1,    -1,    79,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    46,    47,    -1,
+      -1,    -1,    -1,    -1,    79,    54,    55,    56,    57,    58,
+      59,    60,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    46,    47,
+      79,    -1,    -1,    -1,    -1,    -1,    54,    55,    56,    57,
+      58,    59,    60
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    23,    89,    90,    91,    96,     9,     0,    91,    96,
+       5,     6,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    24,    25,    26,    80,    83,
+      97,    98,    99,    78,    34,    35,    36,    84,    85,    29,
+      30,    31,    32,    33,    37,    38,    39,    40,    41,    62,
+      63,    84,    85,    78,    78,    78,     3,     4,     5,     6,
+      57,    61,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,   102,   103,    66,    78,
+     102,   102,    78,    78,    78,    78,     9,    78,    78,    97,
+     100,    83,     5,     6,    92,    93,   102,   103,   103,   103,
+     103,   102,   102,   102,   102,   102,   102,   102,   102,   102,
+     102,   102,   102,   102,    98,   103,   103,    85,    85,   102,
+     103,   102,    78,    78,    78,    78,    78,    78,    78,    78,
+      78,    78,    78,    78,   102,   103,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    42,    43,    44,    78,   102,     6,     6,   101,
+     103,   101,    78,     6,     6,    81,    97,    79,    82,    86,
+      86,    83,    79,    79,   102,   102,   103,   103,   102,   102,
+     102,   102,   102,   102,   102,   102,   102,   102,    79,    79,
+     102,   102,   102,   102,   102,   102,   102,   102,   102,   102,
+     102,   102,   102,   102,   102,   102,   103,   103,   103,   103,
+      82,    82,    79,    83,    79,    94,    95,   102,   103,    82,
+      82,    80,    93,    34,    35,    36,    84,    85,    29,    30,
+      31,    32,    33,    37,    38,    39,    40,    41,    62,    63,
+      84,    85,   103,    97,    97,    86,    86,    82,    79,    79,
+      79,    82,    82,    82,    82,    82,    82,    82,    82,    82,
+     102,   102,   103,    79,    82,   102,   102,   100,   103,   103,
+     103,   103,   102,   102,   102,   102,   102,   102,   102,   102,
+     102,   102,   102,   102,   102,    83,    28,    85,    85,   102,
+     103,     5,   103,   104,   105,   104,   104,   102,   106,   102,
+     102,   102,   102,   102,    82,    82,    95,    79,    79,    81,
+      86,    86,    98,    97,   102,   102,    82,    82,    85,    79,
+      82,    79,    79,    82,    79,    82,    79,    79,    79,    79,
+     102,   102,    34,    35,    36,    84,    29,    30,    31,    32,
+      33,    37,    38,    39,    40,    41,    62,    63,    84,    79,
+      86,    86,   102,   103,   102,   105,   105,   102,    79,    79,
+     103,   103,   103,   103,   102,   102,   102,   102,   102,   102,
+     102,   102,   102,   102,   102,    97,    79,    79,    86,    87,
+      82,    85,    87,   105,   102,   102,    87,    86,    87,   102,
+      86
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    88,    89,    89,    90,    90,    91,    92,    92,    93,
+      93,    94,    94,    95,    95,    96,    96,    97,    97,    98,
+      98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    98,    98,    98,    98,    98,    98,    98,
+      98,    98,    98,    98,    98,    99,    99,    99,    99,    99,
+     100,   100,   101,   101,   102,   102,   102,   102,   102,   102,
+     102,   102,   102,   102,   102,   102,   102,   102,   102,   102,
+     102,   102,   102,   102,   103,   103,   103,   103,   103,   103,
+     103,   103,   103,   103,   103,   103,   103,   103,   103,   103,
+     103,   103,   103,   103,   103,   103,   103,   103,   103,   104,
+     104,   105,   105,   105,   106,   106
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     2,     1,     1,     2,     8,     1,     3,     1,
+       1,     1,     3,     1,     1,     2,     0,     2,     1,     1,
+       5,     1,     1,     1,     2,     2,     2,     2,     8,     8,
+       6,     6,     4,     4,     3,     6,     9,     2,     5,     8,
+       2,     5,     8,     3,     6,     9,     3,     6,     9,     3,
+       6,     9,     3,     6,     9,     3,     6,     9,     3,     6,
+       9,     3,     6,     9,     3,     6,     9,     3,     6,     9,
+       3,     6,     9,     3,     6,     9,     3,     6,     9,     3,
+       6,     9,     3,     6,     9,     5,     9,     5,     7,     3,
+       1,     2,     1,     3,     1,     1,     4,     7,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     8,
+       4,     4,     2,     3,     1,     1,     4,     7,     3,     3,
+       3,     2,     3,     3,     3,     3,     3,     3,     8,     4,
+       6,     6,     6,     6,     6,     6,     6,     6,     3,     1,
+       3,     1,     7,    10,     3,     5
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: procedure_list main  */
+#line 63 "Parser/ursa.ypp"
+                                      { exit(0); }
+#line 1605 "ursa.tab.cpp"
+    break;
+
+  case 3: /* program: main  */
+#line 64 "Parser/ursa.ypp"
+                                      { exit(0); }
+#line 1611 "ursa.tab.cpp"
+    break;
+
+  case 4: /* procedure_list: procedure  */
+#line 68 "Parser/ursa.ypp"
+                                      { store_procedure((yyvsp[0].nPtr)); }
+#line 1617 "ursa.tab.cpp"
+    break;
+
+  case 5: /* procedure_list: procedure_list procedure  */
+#line 69 "Parser/ursa.ypp"
+                                      { store_procedure((yyvsp[0].nPtr)); }
+#line 1623 "ursa.tab.cpp"
+    break;
+
+  case 6: /* procedure: PROCEDURE PROCEDURE_ID '(' form_arg_list ')' '{' stmt_list '}'  */
+#line 73 "Parser/ursa.ypp"
+                                                                       { (yyval.nPtr) = opr(PROCEDURE, 3,  id((yyvsp[-6].sName)), (yyvsp[-4].nPtr), (yyvsp[-1].nPtr)); }
+#line 1629 "ursa.tab.cpp"
+    break;
+
+  case 7: /* form_arg_list: form_arg  */
+#line 77 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 1635 "ursa.tab.cpp"
+    break;
+
+  case 8: /* form_arg_list: form_arg_list ',' form_arg  */
+#line 78 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = opr(';', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 1641 "ursa.tab.cpp"
+    break;
+
+  case 9: /* form_arg: INTEGER_VARIABLE  */
+#line 82 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = id((yyvsp[0].sName)); }
+#line 1647 "ursa.tab.cpp"
+    break;
+
+  case 10: /* form_arg: BOOLEAN_VARIABLE  */
+#line 83 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = id((yyvsp[0].sName)); }
+#line 1653 "ursa.tab.cpp"
+    break;
+
+  case 11: /* arg_list: arg  */
+#line 87 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 1659 "ursa.tab.cpp"
+    break;
+
+  case 12: /* arg_list: arg_list ',' arg  */
+#line 88 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = opr(';', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 1665 "ursa.tab.cpp"
+    break;
+
+  case 13: /* arg: expr  */
+#line 92 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 1671 "ursa.tab.cpp"
+    break;
+
+  case 14: /* arg: bool_expr  */
+#line 93 "Parser/ursa.ypp"
+                                           { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 1677 "ursa.tab.cpp"
+    break;
+
+  case 15: /* main: main stmt  */
+#line 98 "Parser/ursa.ypp"
+                            { ex((yyvsp[0].nPtr)); /* freeNode($2); */ }
+#line 1683 "ursa.tab.cpp"
+    break;
+
+  case 17: /* stmt: single_stmt ';'  */
+#line 104 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = (yyvsp[-1].nPtr); }
+#line 1689 "ursa.tab.cpp"
+    break;
+
+  case 18: /* stmt: comp_stmt  */
+#line 105 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 1695 "ursa.tab.cpp"
+    break;
+
+  case 19: /* single_stmt: ';'  */
+#line 109 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(';', 2, NULL, NULL); }
+#line 1701 "ursa.tab.cpp"
+    break;
+
+  case 20: /* single_stmt: CALL PROCEDURE_ID '(' arg_list ')'  */
+#line 110 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(CALL, 2,  id((yyvsp[-3].sName)), (yyvsp[-1].nPtr)); }
+#line 1707 "ursa.tab.cpp"
+    break;
+
+  case 21: /* single_stmt: LIST  */
+#line 111 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(LIST, 0); }
+#line 1713 "ursa.tab.cpp"
+    break;
+
+  case 22: /* single_stmt: CLEAR  */
+#line 112 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(CLEAR, 0); }
+#line 1719 "ursa.tab.cpp"
+    break;
+
+  case 23: /* single_stmt: HALT  */
+#line 113 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(HALT, 0); }
+#line 1725 "ursa.tab.cpp"
+    break;
+
+  case 24: /* single_stmt: PRINT expr  */
+#line 114 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PRINT, 1, (yyvsp[0].nPtr)); }
+#line 1731 "ursa.tab.cpp"
+    break;
+
+  case 25: /* single_stmt: PRINTB expr  */
+#line 115 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PRINTB, 1, (yyvsp[0].nPtr)); }
+#line 1737 "ursa.tab.cpp"
+    break;
+
+  case 26: /* single_stmt: PRINTX expr  */
+#line 116 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PRINTX, 1, (yyvsp[0].nPtr)); }
+#line 1743 "ursa.tab.cpp"
+    break;
+
+  case 27: /* single_stmt: PRINT bool_expr  */
+#line 117 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PRINT, 1, (yyvsp[0].nPtr)); }
+#line 1749 "ursa.tab.cpp"
+    break;
+
+  case 28: /* single_stmt: MINIMIZE '(' INTEGER_VARIABLE ',' expr ',' expr ')'  */
+#line 118 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(MINIMIZE, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 1755 "ursa.tab.cpp"
+    break;
+
+  case 29: /* single_stmt: MAXIMIZE '(' INTEGER_VARIABLE ',' expr ',' expr ')'  */
+#line 119 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(MAXIMIZE, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 1761 "ursa.tab.cpp"
+    break;
+
+  case 30: /* single_stmt: WIDTH '(' INTEGER_VARIABLE ',' expr ')'  */
+#line 120 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(WIDTH, 2, id((yyvsp[-3].sName)), (yyvsp[-1].nPtr)); }
+#line 1767 "ursa.tab.cpp"
+    break;
+
+  case 31: /* single_stmt: SWIDTH '(' INTEGER_VARIABLE ',' expr ')'  */
+#line 121 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(SWIDTH, 2, id((yyvsp[-3].sName)), (yyvsp[-1].nPtr)); }
+#line 1773 "ursa.tab.cpp"
+    break;
+
+  case 32: /* single_stmt: ASSERT '(' constraint_list ')'  */
+#line 122 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(ASSERT, 1, (yyvsp[-1].nPtr)); }
+#line 1779 "ursa.tab.cpp"
+    break;
+
+  case 33: /* single_stmt: ASSERTA '(' constraint_list ')'  */
+#line 123 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(ASSERTA, 1, (yyvsp[-1].nPtr)); }
+#line 1785 "ursa.tab.cpp"
+    break;
+
+  case 34: /* single_stmt: INTEGER_VARIABLE '=' expr  */
+#line 125 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr('=', 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1791 "ursa.tab.cpp"
+    break;
+
+  case 35: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '=' expr  */
+#line 126 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr('=', 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1797 "ursa.tab.cpp"
+    break;
+
+  case 36: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' '=' expr  */
+#line 127 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr('=', 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1803 "ursa.tab.cpp"
+    break;
+
+  case 37: /* single_stmt: INTEGER_VARIABLE PLUSPLUS  */
+#line 129 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PLUSPLUS, 1, id((yyvsp[-1].sName))); }
+#line 1809 "ursa.tab.cpp"
+    break;
+
+  case 38: /* single_stmt: INTEGER_VARIABLE '[' expr ']' PLUSPLUS  */
+#line 130 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PLUSPLUS, 2, id((yyvsp[-4].sName)), (yyvsp[-2].nPtr)); }
+#line 1815 "ursa.tab.cpp"
+    break;
+
+  case 39: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' PLUSPLUS  */
+#line 131 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(PLUSPLUS, 3, id((yyvsp[-7].sName)), (yyvsp[-5].nPtr), (yyvsp[-2].nPtr)); }
+#line 1821 "ursa.tab.cpp"
+    break;
+
+  case 40: /* single_stmt: INTEGER_VARIABLE MINUSMINUS  */
+#line 133 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MINUSMINUS, 1, id((yyvsp[-1].sName))); }
+#line 1827 "ursa.tab.cpp"
+    break;
+
+  case 41: /* single_stmt: INTEGER_VARIABLE '[' expr ']' MINUSMINUS  */
+#line 134 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MINUSMINUS, 2, id((yyvsp[-4].sName)), (yyvsp[-2].nPtr)); }
+#line 1833 "ursa.tab.cpp"
+    break;
+
+  case 42: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' MINUSMINUS  */
+#line 135 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MINUSMINUS, 3, id((yyvsp[-7].sName)), (yyvsp[-5].nPtr), (yyvsp[-2].nPtr)); }
+#line 1839 "ursa.tab.cpp"
+    break;
+
+  case 43: /* single_stmt: INTEGER_VARIABLE PLUSEQ expr  */
+#line 137 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(PLUSEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1845 "ursa.tab.cpp"
+    break;
+
+  case 44: /* single_stmt: INTEGER_VARIABLE '[' expr ']' PLUSEQ expr  */
+#line 138 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(PLUSEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1851 "ursa.tab.cpp"
+    break;
+
+  case 45: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' PLUSEQ expr  */
+#line 139 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(PLUSEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1857 "ursa.tab.cpp"
+    break;
+
+  case 46: /* single_stmt: INTEGER_VARIABLE MINUSEQ expr  */
+#line 141 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MINUSEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1863 "ursa.tab.cpp"
+    break;
+
+  case 47: /* single_stmt: INTEGER_VARIABLE '[' expr ']' MINUSEQ expr  */
+#line 142 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MINUSEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1869 "ursa.tab.cpp"
+    break;
+
+  case 48: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' MINUSEQ expr  */
+#line 143 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MINUSEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1875 "ursa.tab.cpp"
+    break;
+
+  case 49: /* single_stmt: INTEGER_VARIABLE MULTEQ expr  */
+#line 145 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MULTEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1881 "ursa.tab.cpp"
+    break;
+
+  case 50: /* single_stmt: INTEGER_VARIABLE '[' expr ']' MULTEQ expr  */
+#line 146 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MULTEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1887 "ursa.tab.cpp"
+    break;
+
+  case 51: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' MULTEQ expr  */
+#line 147 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MULTEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1893 "ursa.tab.cpp"
+    break;
+
+  case 52: /* single_stmt: INTEGER_VARIABLE DIVEQ expr  */
+#line 149 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(DIVEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1899 "ursa.tab.cpp"
+    break;
+
+  case 53: /* single_stmt: INTEGER_VARIABLE '[' expr ']' DIVEQ expr  */
+#line 150 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(DIVEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1905 "ursa.tab.cpp"
+    break;
+
+  case 54: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' DIVEQ expr  */
+#line 151 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(DIVEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1911 "ursa.tab.cpp"
+    break;
+
+  case 55: /* single_stmt: INTEGER_VARIABLE MODEQ expr  */
+#line 153 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MODEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1917 "ursa.tab.cpp"
+    break;
+
+  case 56: /* single_stmt: INTEGER_VARIABLE '[' expr ']' MODEQ expr  */
+#line 154 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MODEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1923 "ursa.tab.cpp"
+    break;
+
+  case 57: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' MODEQ expr  */
+#line 155 "Parser/ursa.ypp"
+                                                                  { (yyval.nPtr) = opr(MODEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1929 "ursa.tab.cpp"
+    break;
+
+  case 58: /* single_stmt: INTEGER_VARIABLE BITWISEANDEQ expr  */
+#line 157 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEANDEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1935 "ursa.tab.cpp"
+    break;
+
+  case 59: /* single_stmt: INTEGER_VARIABLE '[' expr ']' BITWISEANDEQ expr  */
+#line 158 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEANDEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1941 "ursa.tab.cpp"
+    break;
+
+  case 60: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' BITWISEANDEQ expr  */
+#line 159 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEANDEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1947 "ursa.tab.cpp"
+    break;
+
+  case 61: /* single_stmt: INTEGER_VARIABLE BITWISEOREQ expr  */
+#line 161 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEOREQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1953 "ursa.tab.cpp"
+    break;
+
+  case 62: /* single_stmt: INTEGER_VARIABLE '[' expr ']' BITWISEOREQ expr  */
+#line 162 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEOREQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1959 "ursa.tab.cpp"
+    break;
+
+  case 63: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' BITWISEOREQ expr  */
+#line 163 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEOREQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1965 "ursa.tab.cpp"
+    break;
+
+  case 64: /* single_stmt: INTEGER_VARIABLE BITWISEXOREQ expr  */
+#line 165 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEXOREQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1971 "ursa.tab.cpp"
+    break;
+
+  case 65: /* single_stmt: INTEGER_VARIABLE '[' expr ']' BITWISEXOREQ expr  */
+#line 166 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEXOREQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1977 "ursa.tab.cpp"
+    break;
+
+  case 66: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' BITWISEXOREQ expr  */
+#line 167 "Parser/ursa.ypp"
+                                                                         { (yyval.nPtr) = opr(BITWISEXOREQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1983 "ursa.tab.cpp"
+    break;
+
+  case 67: /* single_stmt: INTEGER_VARIABLE LSHIFTEQ expr  */
+#line 169 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(LSHIFTEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 1989 "ursa.tab.cpp"
+    break;
+
+  case 68: /* single_stmt: INTEGER_VARIABLE '[' expr ']' LSHIFTEQ expr  */
+#line 170 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(LSHIFTEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 1995 "ursa.tab.cpp"
+    break;
+
+  case 69: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' LSHIFTEQ expr  */
+#line 171 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(LSHIFTEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2001 "ursa.tab.cpp"
+    break;
+
+  case 70: /* single_stmt: INTEGER_VARIABLE RSHIFTEQ expr  */
+#line 173 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(RSHIFTEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 2007 "ursa.tab.cpp"
+    break;
+
+  case 71: /* single_stmt: INTEGER_VARIABLE '[' expr ']' RSHIFTEQ expr  */
+#line 174 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(RSHIFTEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2013 "ursa.tab.cpp"
+    break;
+
+  case 72: /* single_stmt: INTEGER_VARIABLE '[' expr ']' '[' expr ']' RSHIFTEQ expr  */
+#line 175 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(RSHIFTEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2019 "ursa.tab.cpp"
+    break;
+
+  case 73: /* single_stmt: BOOLEAN_VARIABLE '=' bool_expr  */
+#line 177 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr('=', 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 2025 "ursa.tab.cpp"
+    break;
+
+  case 74: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' '=' bool_expr  */
+#line 178 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr('=', 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2031 "ursa.tab.cpp"
+    break;
+
+  case 75: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' '[' expr ']' '=' bool_expr  */
+#line 179 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr('=', 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2037 "ursa.tab.cpp"
+    break;
+
+  case 76: /* single_stmt: BOOLEAN_VARIABLE ANDEQ bool_expr  */
+#line 181 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(ANDEQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 2043 "ursa.tab.cpp"
+    break;
+
+  case 77: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' ANDEQ bool_expr  */
+#line 182 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(ANDEQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2049 "ursa.tab.cpp"
+    break;
+
+  case 78: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' '[' expr ']' ANDEQ bool_expr  */
+#line 183 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(ANDEQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2055 "ursa.tab.cpp"
+    break;
+
+  case 79: /* single_stmt: BOOLEAN_VARIABLE OREQ bool_expr  */
+#line 185 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(OREQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 2061 "ursa.tab.cpp"
+    break;
+
+  case 80: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' OREQ bool_expr  */
+#line 186 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(OREQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2067 "ursa.tab.cpp"
+    break;
+
+  case 81: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' '[' expr ']' OREQ bool_expr  */
+#line 187 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(OREQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2073 "ursa.tab.cpp"
+    break;
+
+  case 82: /* single_stmt: BOOLEAN_VARIABLE XOREQ bool_expr  */
+#line 189 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(XOREQ, 2, id((yyvsp[-2].sName)), (yyvsp[0].nPtr)); }
+#line 2079 "ursa.tab.cpp"
+    break;
+
+  case 83: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' XOREQ bool_expr  */
+#line 190 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(XOREQ, 3, id((yyvsp[-5].sName)), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2085 "ursa.tab.cpp"
+    break;
+
+  case 84: /* single_stmt: BOOLEAN_VARIABLE '[' expr ']' '[' expr ']' XOREQ bool_expr  */
+#line 191 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr(XOREQ, 4, id((yyvsp[-8].sName)), (yyvsp[-6].nPtr), (yyvsp[-3].nPtr), (yyvsp[0].nPtr)); }
+#line 2091 "ursa.tab.cpp"
+    break;
+
+  case 85: /* comp_stmt: WHILE '(' bool_expr ')' stmt  */
+#line 195 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(WHILE, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2097 "ursa.tab.cpp"
+    break;
+
+  case 86: /* comp_stmt: FOR '(' single_stmt ';' bool_expr ';' single_stmt ')' stmt  */
+#line 196 "Parser/ursa.ypp"
+                                                                      { (yyval.nPtr) = opr(FOR, 4, (yyvsp[-6].nPtr), (yyvsp[-4].nPtr), (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2103 "ursa.tab.cpp"
+    break;
+
+  case 87: /* comp_stmt: IF '(' bool_expr ')' stmt  */
+#line 197 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(IF, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2109 "ursa.tab.cpp"
+    break;
+
+  case 88: /* comp_stmt: IF '(' bool_expr ')' stmt ELSE stmt  */
+#line 198 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(IF, 3, (yyvsp[-4].nPtr), (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2115 "ursa.tab.cpp"
+    break;
+
+  case 89: /* comp_stmt: '{' stmt_list '}'  */
+#line 199 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = (yyvsp[-1].nPtr); }
+#line 2121 "ursa.tab.cpp"
+    break;
+
+  case 90: /* stmt_list: stmt  */
+#line 203 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 2127 "ursa.tab.cpp"
+    break;
+
+  case 91: /* stmt_list: stmt_list stmt  */
+#line 204 "Parser/ursa.ypp"
+                                                              { (yyval.nPtr) = opr(';', 2, (yyvsp[-1].nPtr), (yyvsp[0].nPtr)); }
+#line 2133 "ursa.tab.cpp"
+    break;
+
+  case 92: /* constraint_list: bool_expr  */
+#line 209 "Parser/ursa.ypp"
+                                         { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 2139 "ursa.tab.cpp"
+    break;
+
+  case 93: /* constraint_list: constraint_list ';' bool_expr  */
+#line 210 "Parser/ursa.ypp"
+                                         { (yyval.nPtr) = opr(';', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2145 "ursa.tab.cpp"
+    break;
+
+  case 94: /* expr: INTEGER  */
+#line 214 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = intConst((yyvsp[0].sValue)); }
+#line 2151 "ursa.tab.cpp"
+    break;
+
+  case 95: /* expr: INTEGER_VARIABLE  */
+#line 215 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = id((yyvsp[0].sName)); }
+#line 2157 "ursa.tab.cpp"
+    break;
+
+  case 96: /* expr: INTEGER_VARIABLE '[' expr ']'  */
+#line 216 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('@', 2, id((yyvsp[-3].sName)), (yyvsp[-1].nPtr)); }
+#line 2163 "ursa.tab.cpp"
+    break;
+
+  case 97: /* expr: INTEGER_VARIABLE '[' expr ']' '[' expr ']'  */
+#line 217 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('@', 3, id((yyvsp[-6].sName)), (yyvsp[-4].nPtr), (yyvsp[-1].nPtr)); }
+#line 2169 "ursa.tab.cpp"
+    break;
+
+  case 98: /* expr: '-' expr  */
+#line 218 "Parser/ursa.ypp"
+                                { (yyval.nPtr) = opr(UMINUS, 1, (yyvsp[0].nPtr)); }
+#line 2175 "ursa.tab.cpp"
+    break;
+
+  case 99: /* expr: expr LSHIFT expr  */
+#line 219 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(LSHIFT, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2181 "ursa.tab.cpp"
+    break;
+
+  case 100: /* expr: expr RSHIFT expr  */
+#line 220 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(RSHIFT, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2187 "ursa.tab.cpp"
+    break;
+
+  case 101: /* expr: expr '+' expr  */
+#line 221 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('+', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2193 "ursa.tab.cpp"
+    break;
+
+  case 102: /* expr: expr '-' expr  */
+#line 222 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('-', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2199 "ursa.tab.cpp"
+    break;
+
+  case 103: /* expr: expr '*' expr  */
+#line 223 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('*', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2205 "ursa.tab.cpp"
+    break;
+
+  case 104: /* expr: expr '/' expr  */
+#line 224 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('/', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2211 "ursa.tab.cpp"
+    break;
+
+  case 105: /* expr: expr '%' expr  */
+#line 225 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('%', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2217 "ursa.tab.cpp"
+    break;
+
+  case 106: /* expr: expr '&' expr  */
+#line 226 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('&', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2223 "ursa.tab.cpp"
+    break;
+
+  case 107: /* expr: expr '|' expr  */
+#line 227 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('|', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2229 "ursa.tab.cpp"
+    break;
+
+  case 108: /* expr: expr '^' expr  */
+#line 228 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('^', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2235 "ursa.tab.cpp"
+    break;
+
+  case 109: /* expr: ITE '(' bool_expr ',' expr ',' expr ')'  */
+#line 229 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(ITE, 3, (yyvsp[-5].nPtr), (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2241 "ursa.tab.cpp"
+    break;
+
+  case 110: /* expr: BOOL2NUM '(' bool_expr ')'  */
+#line 230 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(BOOL2NUM, 1, (yyvsp[-1].nPtr)); }
+#line 2247 "ursa.tab.cpp"
+    break;
+
+  case 111: /* expr: SGN '(' expr ')'  */
+#line 231 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(SGN, 1, (yyvsp[-1].nPtr)); }
+#line 2253 "ursa.tab.cpp"
+    break;
+
+  case 112: /* expr: '~' expr  */
+#line 232 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('~', 1, (yyvsp[0].nPtr)); }
+#line 2259 "ursa.tab.cpp"
+    break;
+
+  case 113: /* expr: '(' expr ')'  */
+#line 233 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = (yyvsp[-1].nPtr); }
+#line 2265 "ursa.tab.cpp"
+    break;
+
+  case 114: /* bool_expr: BOOLEAN  */
+#line 237 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = boolConst((yyvsp[0].bValue)); }
+#line 2271 "ursa.tab.cpp"
+    break;
+
+  case 115: /* bool_expr: BOOLEAN_VARIABLE  */
+#line 238 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = id((yyvsp[0].sName)); }
+#line 2277 "ursa.tab.cpp"
+    break;
+
+  case 116: /* bool_expr: BOOLEAN_VARIABLE '[' expr ']'  */
+#line 239 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('@', 2, id((yyvsp[-3].sName)), (yyvsp[-1].nPtr)); }
+#line 2283 "ursa.tab.cpp"
+    break;
+
+  case 117: /* bool_expr: BOOLEAN_VARIABLE '[' expr ']' '[' expr ']'  */
+#line 240 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('@', 3, id((yyvsp[-6].sName)), (yyvsp[-4].nPtr), (yyvsp[-1].nPtr)); }
+#line 2289 "ursa.tab.cpp"
+    break;
+
+  case 118: /* bool_expr: bool_expr LOGICALAND bool_expr  */
+#line 241 "Parser/ursa.ypp"
+                                                         { (yyval.nPtr) = opr(LOGICALAND, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2295 "ursa.tab.cpp"
+    break;
+
+  case 119: /* bool_expr: bool_expr LOGICALOR bool_expr  */
+#line 242 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(LOGICALOR, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2301 "ursa.tab.cpp"
+    break;
+
+  case 120: /* bool_expr: bool_expr LOGICALXOR bool_expr  */
+#line 243 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(LOGICALXOR, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2307 "ursa.tab.cpp"
+    break;
+
+  case 121: /* bool_expr: '!' bool_expr  */
+#line 244 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('!', 1, (yyvsp[0].nPtr)); }
+#line 2313 "ursa.tab.cpp"
+    break;
+
+  case 122: /* bool_expr: expr '<' expr  */
+#line 245 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('<', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2319 "ursa.tab.cpp"
+    break;
+
+  case 123: /* bool_expr: expr '>' expr  */
+#line 246 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('>', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2325 "ursa.tab.cpp"
+    break;
+
+  case 124: /* bool_expr: expr GE expr  */
+#line 247 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(GE, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2331 "ursa.tab.cpp"
+    break;
+
+  case 125: /* bool_expr: expr LE expr  */
+#line 248 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(LE, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2337 "ursa.tab.cpp"
+    break;
+
+  case 126: /* bool_expr: expr NE expr  */
+#line 249 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(NE, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2343 "ursa.tab.cpp"
+    break;
+
+  case 127: /* bool_expr: expr EQ expr  */
+#line 250 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(EQ, 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2349 "ursa.tab.cpp"
+    break;
+
+  case 128: /* bool_expr: ITE '(' bool_expr ',' bool_expr ',' bool_expr ')'  */
+#line 251 "Parser/ursa.ypp"
+                                                             { (yyval.nPtr) = opr(ITE, 3, (yyvsp[-5].nPtr), (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2355 "ursa.tab.cpp"
+    break;
+
+  case 129: /* bool_expr: NUM2BOOL '(' expr ')'  */
+#line 252 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(NUM2BOOL, 1, (yyvsp[-1].nPtr)); }
+#line 2361 "ursa.tab.cpp"
+    break;
+
+  case 130: /* bool_expr: SLT '(' expr ',' expr ')'  */
+#line 253 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(SLT, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2367 "ursa.tab.cpp"
+    break;
+
+  case 131: /* bool_expr: SGT '(' expr ',' expr ')'  */
+#line 254 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(SGT, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2373 "ursa.tab.cpp"
+    break;
+
+  case 132: /* bool_expr: SLE '(' expr ',' expr ')'  */
+#line 255 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(SLE, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2379 "ursa.tab.cpp"
+    break;
+
+  case 133: /* bool_expr: SGE '(' expr ',' expr ')'  */
+#line 256 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(SGE, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2385 "ursa.tab.cpp"
+    break;
+
+  case 134: /* bool_expr: ATMOST '(' expr ',' bool_list ')'  */
+#line 257 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(ATMOST, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2391 "ursa.tab.cpp"
+    break;
+
+  case 135: /* bool_expr: ATLEAST '(' expr ',' bool_list ')'  */
+#line 258 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(ATLEAST, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2397 "ursa.tab.cpp"
+    break;
+
+  case 136: /* bool_expr: EXACTLY '(' expr ',' bool_list ')'  */
+#line 259 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(EXACTLY, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2403 "ursa.tab.cpp"
+    break;
+
+  case 137: /* bool_expr: PB_LE '(' expr ',' pb_list ')'  */
+#line 260 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(PB_LE, 2, (yyvsp[-3].nPtr), (yyvsp[-1].nPtr)); }
+#line 2409 "ursa.tab.cpp"
+    break;
+
+  case 138: /* bool_expr: '(' bool_expr ')'  */
+#line 261 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = (yyvsp[-1].nPtr); }
+#line 2415 "ursa.tab.cpp"
+    break;
+
+  case 139: /* bool_list: bool_item  */
+#line 266 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 2421 "ursa.tab.cpp"
+    break;
+
+  case 140: /* bool_list: bool_list ',' bool_item  */
+#line 267 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(';', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2427 "ursa.tab.cpp"
+    break;
+
+  case 141: /* bool_item: bool_expr  */
+#line 271 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = (yyvsp[0].nPtr); }
+#line 2433 "ursa.tab.cpp"
+    break;
+
+  case 142: /* bool_item: BOOLEAN_VARIABLE '[' expr '.' '.' expr ']'  */
+#line 272 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr('.', 3, id((yyvsp[-6].sName)), (yyvsp[-4].nPtr), (yyvsp[-1].nPtr)); }
+#line 2439 "ursa.tab.cpp"
+    break;
+
+  case 143: /* bool_item: BOOLEAN_VARIABLE '[' expr ']' '[' expr '.' '.' expr ']'  */
+#line 273 "Parser/ursa.ypp"
+                                                                     { (yyval.nPtr) = opr('.', 4, id((yyvsp[-9].sName)), (yyvsp[-7].nPtr), (yyvsp[-4].nPtr), (yyvsp[-1].nPtr)); }
+#line 2445 "ursa.tab.cpp"
+    break;
+
+  case 144: /* pb_list: expr ',' bool_item  */
+#line 278 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr('*', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr)); }
+#line 2451 "ursa.tab.cpp"
+    break;
+
+  case 145: /* pb_list: pb_list ',' expr ',' bool_item  */
+#line 279 "Parser/ursa.ypp"
+                                                     { (yyval.nPtr) = opr(';', 2, (yyvsp[-4].nPtr), opr('*', 2, (yyvsp[-2].nPtr), (yyvsp[0].nPtr))); }
+#line 2457 "ursa.tab.cpp"
+    break;
+
+
+#line 2461 "ursa.tab.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 283 "Parser/ursa.ypp"
+
+
+#define SIZEOF_NODETYPE ((char *)&p->intConst - (char *)p)
+
+
+nodeType *intConst(char* value) {
+    nodeType *p;
+    size_t nodeSize;
+
+    /* allocate node */
+    nodeSize = SIZEOF_NODETYPE + sizeof(intConstNodeType);
+    if ((p = (nodeType*)malloc(nodeSize)) == NULL)
+        yyerror((char*)"out of memory");
+
+    /* copy information */
+    p->type = typeIntConst;
+    p->intConst.value = value;
+
+    return p;
+}
+
+
+nodeType *boolConst(bool value) {
+    nodeType *p;
+    size_t nodeSize;
+
+    /* allocate node */
+    nodeSize = SIZEOF_NODETYPE + sizeof(boolConstNodeType);
+    if ((p = (nodeType*)malloc(nodeSize)) == NULL)
+        yyerror((char*)"out of memory");
+
+    /* copy information */
+    p->type = typeBoolConst;
+    p->boolConst.value = value;
+
+    return p;
+}
+
+
+
+nodeType *id(char *i) {
+    nodeType *p;
+    size_t nodeSize;
+
+    /* allocate node */
+    nodeSize = SIZEOF_NODETYPE + sizeof(idNodeType);
+    if ((p = (nodeType*)malloc(nodeSize)) == NULL)
+        yyerror((char*)"out of memory");
+
+    /* copy information */
+    p->type = typeId;
+    p->id.i = i;
+    p->id.n = intern(i);
+
+    return p;
+}
+
+nodeType *opr(int oper, int nops, ...) {
+    va_list ap;
+    nodeType *p;
+    size_t nodeSize;
+    int i;
+
+    /* allocate node */
+    nodeSize = SIZEOF_NODETYPE + sizeof(oprNodeType) +
+        (nops - 1) * sizeof(nodeType*);
+    if ((p = (nodeType*)malloc(nodeSize)) == NULL)
+        yyerror((char*)"out of memory");
+
+    /* copy information */
+    p->type = typeOpr;
+    p->opr.oper = oper;
+    p->opr.nops = nops;
+    va_start(ap, nops);
+    for (i = 0; i < nops; i++)
+        p->opr.op[i] = va_arg(ap, nodeType*);
+    va_end(ap);
+    return p;
+}
+
+void freeNode(nodeType *p) {
+    int i;
+
+    if (!p) return;
+    if (p->type == typeOpr) {
+        for (i = 0; i < p->opr.nops; i++)
+            freeNode(p->opr.op[i]);
+    }
+    free (p);
+}
+
+void yyerror(char *s) {
+    fprintf(stdout, "%s\n", s);
+}
+
+
+
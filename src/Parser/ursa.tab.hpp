@@ -71,36 +71,47 @@ extern int yydebug;
     HALT = 277,
     PROCEDURE = 278,
     CALL = 279,
-    IFX = 280,
-    ELSE = 281,
-    PLUSEQ = 282,
-    MINUSEQ = 283,
-    MULTEQ = 284,
-    DIVEQ = 285,
-    ANDEQ = 286,
-    OREQ = 287,
-    XOREQ = 288,
-    LSHIFTEQ = 289,
-    RSHIFTEQ = 290,
-    BITWISEANDEQ = 291,
-    BITWISEOREQ = 292,
-    BITWISEXOREQ = 293,
-    LOGICALXOR = 294,
-    LOGICALOR = 295,
-    LOGICALAND = 296,
-    GE = 297,
-    LE = 298,
-    EQ = 299,
-    NE = 300,
-    LSHIFT = 301,
-    RSHIFT = 302,
-    PLUSPLUS = 303,
-    MINUSMINUS = 304,
-    UMINUS = 305,
-    ITE = 306,
-    BOOL2NUM = 307,
-    NUM2BOOL = 308,
-    SGN = 309
+    WIDTH = 280,
+    SWIDTH = 281,
+    IFX = 282,
+    ELSE = 283,
+    PLUSEQ = 284,
+    MINUSEQ = 285,
+    MULTEQ = 286,
+    DIVEQ = 287,
+    MODEQ = 288,
+    ANDEQ = 289,
+    OREQ = 290,
+    XOREQ = 291,
+    LSHIFTEQ = 292,
+    RSHIFTEQ = 293,
+    BITWISEANDEQ = 294,
+    BITWISEOREQ = 295,
+    BITWISEXOREQ = 296,
+    LOGICALXOR = 297,
+    LOGICALOR = 298,
+    LOGICALAND = 299,
+    GE = 300,
+    LE = 301,
+    EQ = 302,
+    NE = 303,
+    LSHIFT = 304,
+    RSHIFT = 305,
+    PLUSPLUS = 306,
+    MINUSMINUS = 307,
+    UMINUS = 308,
+    ITE = 309,
+    BOOL2NUM = 310,
+    NUM2BOOL = 311,
+    SGN = 312,
+    ATMOST = 313,
+    ATLEAST = 314,
+    EXACTLY = 315,
+    PB_LE = 316,
+    SLT = 317,
+    SGT = 318,
+    SLE = 319,
+    SGE = 320
   };
 #endif
 
@@ -28,11 +28,22 @@ void ArgoSATsolver::InitSolver(unsigned int numVars) {
 
 
 
-void ArgoSATsolver::addClause(vector<int> &clause) { 
-  vector<Literal> c;
+void ArgoSATsolver::addClauses(const int* lits, const uint32_t* offsets, size_t n) { 
+  for (size_t i = 0; i < n; i++) {
+    literals.clear();
+    for (uint32_t j = offsets[i]; j < offsets[i+1]; j++) 
+       literals.push_back(Literals::fromInt(lits[j]));
+    solver.addInitialClause(literals);
+  }
+}
+
+
+
+void ArgoSATsolver::addXorClause(vector<int> &clause) { 
+  literals.clear();
   for (vector<int>::iterator it = clause.begin(); it != clause.end(); it++) 
-     c.push_back(Literals::fromInt(*it));
-  solver.addInitialClause(c);
+     literals.push_back(Literals::fromInt(*it));
+  solver.addInitialXorClause(literals);
 }
 
 
@@ -30,13 +30,15 @@ public:
     ArgoSATsolver() { };
     ~ArgoSATsolver() { };
    void InitSolver(unsigned int numVars);
-   void addClause(vector<int> &clause); 
+   void addClauses(const int* lits, const uint32_t* offsets, size_t n);
+   void addXorClause(vector<int> &clause);
    bool solve();
    bool isTrueVar(unsigned int var);
 
 private:
    ArgoSat::Solver solver;
    ArgoSat::Valuation model;
+   std::vector<ArgoSat::Literal> literals;
 
 };
 
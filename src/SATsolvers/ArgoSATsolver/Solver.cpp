@@ -20,6 +20,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 using std::cerr;
 using std::endl;
 
@@ -35,6 +36,7 @@ namespace ArgoSat {
 
   Solver::Solver() 
     : _satisfiable(UNDEF),
+      _xorConflictClause(0),
       _conflictClause(0),
       _backjumpClause(*this),
       _usePureLiteral(false) {
@@ -54,6 +56,8 @@ namespace ArgoSat {
     std::vector<Clause*>::const_iterator jt;
     for (jt = _initialClauses.begin(); jt != _initialClauses.end(); jt++)
       removeClause(*jt);
+
+    removeXorClauses();
     
     _variables.clear();
 
@@ -73,6 +77,8 @@ namespace ArgoSat {
     std::vector<Clause*>::const_iterator jt;
     for (jt = _initialClauses.begin(); jt != _initialClauses.end(); jt++)
       removeClause(*jt);
+
+    removeXorClauses();
     
     _variables.clear();
     _trail.clear();
@@ -185,6 +191,139 @@ namespace ArgoSat {
   }
 
 
+  /****************************************************
+   *      XOR CLAUSES
+   ****************************************************/
+  void Solver::addInitialXorClause(std::vector<Literal>& literals) {
+    if (_satisfiable != FALSE)
+      _satisfiable = UNDEF;
+
+    assert(_trail.currentLevel() == 0);
+
+    // a negative literal flips the parity, a variable that occurs twice
+    // cancels out and an assigned variable is moved into the parity
+    bool parity = true;
+    std::vector<Variable> variables, unassigned;
+    std::vector<Literal>::const_iterator it;
+    for (it = literals.begin(); it != literals.end(); it++) {
+      variables.push_back(Literals::variable(*it));
+      if (Literals::isNegative(*it))
+	parity = !parity;
+    }
+    std::sort(variables.begin(), variables.end());
+
+    for (size_t i = 0; i < variables.size(); i++) {
+      if (i + 1 < variables.size() && variables[i] == variables[i + 1])
+	i++;
+      else if (_trail.isUndefVariable(variables[i]))
+	unassigned.push_back(variables[i]);
+      else if (_trail.isTrueVariable(variables[i]))
+	parity = !parity;
+    }
+
+    if (unassigned.size() == 0) {
+      if (parity)
+	_satisfiable = FALSE;
+    } else if (unassigned.size() == 1) {
+      assertLiteral(Literals::literal(unassigned[0], parity), false);
+      exhaustiveUnitPropagate();
+    } else {
+      XorClause* xorClause = new XorClause;
+      xorClause->variables = unassigned;
+      xorClause->parity = parity;
+      _xorClauses.push_back(xorClause);
+      _xorWatchLists[unassigned[0]].push_back(xorClause);
+      _xorWatchLists[unassigned[1]].push_back(xorClause);
+    }
+  }
+
+  void Solver::notifyXorWatches(Variable variable) {
+    std::vector<XorClause*>& watchList = _xorWatchLists[variable];
+
+    std::vector<XorClause*>::const_iterator currentClause,
+      beg = watchList.begin(), en = watchList.end();
+    std::vector<XorClause*>::iterator lastKeptClause = watchList.begin();
+    for (currentClause = beg; currentClause != en; currentClause++) {
+      XorClause* xorClause = (*currentClause);
+      std::vector<Variable>& variables = xorClause->variables;
+      size_t i, n = variables.size();
+
+      // Assure that the assigned variable is watch 2
+      if (variables[0] == variable)
+	std::swap(variables[0], variables[1]);
+
+      for (i = 2; i < n; i++)
+	if (_trail.isUndefVariable(variables[i]))
+	  break;
+      if (i < n) {
+	std::swap(variables[1], variables[i]);
+	_xorWatchLists[variables[1]].push_back(xorClause);
+	continue;
+      }
+
+      *lastKeptClause++ = xorClause;
+
+      // All variables but watch 1 are assigned
+      bool parity = xorClause->parity;
+      for (i = 1; i < n; i++)
+	if (_trail.isTrueVariable(variables[i]))
+	  parity = !parity;
+
+      if (_trail.isUndefVariable(variables[0])) {
+	Literal literal = Literals::literal(variables[0], parity);
+	Clause* reason = explainXor(xorClause, literal);
+	_xorReasons[literal] = reason;
+	setReason(literal, reason);
+	_trail.enqueueUnitLiteral(literal);
+      } else if (_trail.isTrueVariable(variables[0]) != parity) {
+	delete _xorConflictClause;
+	_xorConflictClause = explainXor(xorClause, Literals::UNDEFINED);
+	_conflictClause = _xorConflictClause;
+	for (currentClause++; currentClause != en; currentClause++)
+	  *lastKeptClause++ = *currentClause;
+	break;
+      }
+    }
+
+    watchList.erase(lastKeptClause, watchList.end());
+  }
+
+  // The clause consists of the given literal and the literals of the other
+  // variables that are false in the trail
+  Clause* Solver::explainXor(const XorClause* xorClause, Literal literal) {
+    std::vector<Literal> literals;
+    std::vector<Variable>::const_iterator it;
+    for (it = xorClause->variables.begin(); it != xorClause->variables.end(); it++) {
+      if (literal != Literals::UNDEFINED && *it == Literals::variable(literal))
+	literals.push_back(literal);
+      else
+	literals.push_back(Literals::literal(*it, !_trail.isTrueVariable(*it)));
+    }
+    return new Clause(literals, true);
+  }
+
+  void Solver::removeXorClauses() {
+    std::vector<XorClause*>::const_iterator it;
+    for (it = _xorClauses.begin(); it != _xorClauses.end(); it++)
+      delete *it;
+    _xorClauses.clear();
+
+    for (Literal l = 0; l < _xorReasons.size(); l++)
+      if (_xorReasons[l] != 0) {
+	if (_reason[l] == _xorReasons[l])
+	  _reason[l] = 0;
+	delete _xorReasons[l];
+	_xorReasons[l] = 0;
+      }
+
+    for (size_t v = 0; v < _xorWatchLists.size(); v++)
+      _xorWatchLists[v].clear();
+
+    delete _xorConflictClause;
+    _xorConflictClause = 0;
+  }
+
+
   /****************************************************
    *       VARIABLE SET
    ****************************************************/
@@ -195,6 +334,9 @@ namespace ArgoSat {
     _reason.push_back(0);
     _watchLists.push_back(std::vector<Clause*>());
     _watchLists.push_back(std::vector<Clause*>());
+    _xorWatchLists.push_back(std::vector<XorClause*>());
+    _xorReasons.push_back(0);
+    _xorReasons.push_back(0);
 	
     return var;
   }
@@ -268,6 +410,8 @@ namespace ArgoSat {
       (*li)->onAssert(l);
 
     notifyWatches(Literals::opposite(l));
+    if (!isConflicting())
+      notifyXorWatches(Literals::variable(l));
   }
 
   bool Solver::allVariablesAssigned() {
@@ -283,6 +427,12 @@ namespace ArgoSat {
     assert(!_trail.empty());
     Literal l = _trail.pop();
 
+    if (_xorReasons[l] != 0) {
+      setReason(l, 0);
+      delete _xorReasons[l];
+      _xorReasons[l] = 0;
+    }
+
     std::vector<SolverListener*>::const_iterator 
       lb = _listeners.begin(), le = _listeners.end(), li;
     for (li = lb; li != le; li++)
@@ -357,6 +507,8 @@ namespace ArgoSat {
       (*li)->onAssert(l);
     }
     notifyWatches(Literals::opposite(l));
+    if (!isConflicting())
+      notifyXorWatches(Literals::variable(l));
 
     return true;
   } 
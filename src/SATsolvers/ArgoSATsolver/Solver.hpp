@@ -136,6 +136,32 @@ namespace ArgoSat {
 //  }
   private: std::vector<Clause*> _initialClauses;
 
+    /****************************************************
+     *      XOR CLAUSES
+     ****************************************************/
+    // A xor clause requires the exclusive disjunction of its literals to be
+    // true. It is kept as a set of variables and a parity; the variables on
+    // the positions 0 and 1 are watched. An implied literal gets an ordinary
+    // clause as its reason, built when the literal is implied and deleted
+    // when it is backtracked.
+  public: void addInitialXorClause(std::vector<Literal>& literals);
+  public: size_t getNumberOfXorClauses() const {
+    return _xorClauses.size();
+  }
+
+  private: struct XorClause {
+    std::vector<Variable> variables;
+    bool parity;
+  };
+  private: std::vector<XorClause*> _xorClauses;
+  private: std::vector< std::vector<XorClause*> > _xorWatchLists;
+  private: std::vector<Clause*> _xorReasons;
+  private: Clause* _xorConflictClause;
+
+  private: void notifyXorWatches(Variable variable);
+  private: Clause* explainXor(const XorClause* xorClause, Literal literal);
+  private: void removeXorClauses();
+
 
     /***************************************************
      *     CONFLICT CLAUSE DETECTION
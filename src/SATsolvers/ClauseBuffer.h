@@ -0,0 +1,74 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA
+ 
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+ 
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#ifndef CLAUSEBUFFER_H_INCLUDED
+#define CLAUSEBUFFER_H_INCLUDED
+
+#include <vector>
+#include <stdint.h>
+#include "SATsolver.h"
+
+using namespace std;
+
+
+// Keeps clauses in a single array of literals: the i-th clause consists of
+// the literals from offsets[i] to offsets[i+1]-1. If a solver is given, the
+// clauses are passed to it in batches of about BATCH_LITERALS literals;
+// otherwise all the clauses are kept. The last batch is passed by flush()
+class ClauseBuffer : public ClauseSink {
+
+public:
+  enum { BATCH_LITERALS = 1 << 16 };
+
+  ClauseBuffer(SATsolver *s = 0) : solver(s) { offsets.push_back(0); };
+
+  void addClause(vector<int> &clause) {
+    literals.insert(literals.end(), clause.begin(), clause.end());
+    offsets.push_back(literals.size());
+    if (solver && literals.size() >= BATCH_LITERALS)
+      flush();
+  }
+
+  // xor clauses are passed to the solver at once
+  void addXorClause(vector<int> &clause) {
+    assert(solver);
+    flush();
+    solver->addXorClause(clause);
+  }
+
+  // passes the kept clauses to the solver
+  void flush() {
+    if (solver && size()) {
+      solver->addClauses(getLiterals(), getOffsets(), size());
+      clear();
+    }
+  }
+
+  void clear() {
+    literals.clear();
+    offsets.resize(1);
+  }
+
+  size_t size() const { return offsets.size() - 1; }
+  const int* getLiterals() const { return literals.data(); }
+  const uint32_t* getOffsets() const { return offsets.data(); }
+
+private:
+  SATsolver *solver;
+  vector<int> literals;
+  vector<uint32_t> offsets;
+};
+
+#endif
@@ -0,0 +1,38 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA
+ 
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+ 
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#ifndef CLAUSESINK_H_INCLUDED
+#define CLAUSESINK_H_INCLUDED
+
+#include <assert.h>
+#include <vector>
+
+using namespace std;
+
+
+// Receives the clauses of a CNF one by one, as they are generated
+class ClauseSink {
+
+public:
+  ClauseSink() {};
+  virtual ~ClauseSink() {};
+
+  virtual void addClause(vector<int> &clause)=0;
+  // the exclusive disjunction of the literals has to be true; only the
+  // sinks that support native xor clauses are given such clauses
+  virtual void addXorClause(vector<int> &/*clause*/) { assert(false); }
+};
+
+#endif
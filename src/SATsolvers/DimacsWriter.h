@@ -0,0 +1,47 @@
+/************************************************************************************
+URSA -- Copyright (c) 2010, Predrag Janicic
+
+This file is part of URSA
+ 
+URSA is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+ 
+URSA is WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+**************************************************************************************/
+
+#ifndef DIMACSWRITER_H_INCLUDED
+#define DIMACSWRITER_H_INCLUDED
+
+#include <iostream>
+#include "ClauseSink.h"
+
+using namespace std;
+
+
+// Prints the clauses in DIMACS format (the header is printed by the caller);
+// xor clauses are printed as lines starting with x (as in CryptoMiniSat)
+class DimacsWriter : public ClauseSink {
+
+public:
+  DimacsWriter(ostream &o) : out(o) {};
+
+  void addClause(vector<int> &clause) {
+    for (vector<int>::iterator it = clause.begin(); it != clause.end(); it++) 
+      out << *it << " ";                              
+    out << "0\n";
+  }
+
+  void addXorClause(vector<int> &clause) {
+    out << "x";
+    addClause(clause);
+  }
+
+private:
+  ostream &out;
+};
+
+#endif
@@ -15,18 +15,28 @@ GNU General Public License for more details.
 
 #ifndef SATSOLVER_H_INCLUDED
 #define SATSOLVER_H_INCLUDED
+
+#include <vector>
+#include <stdint.h>
+#include "ClauseSink.h"
 
 using namespace std;
 
 
-class SATsolver {
+class SATsolver : public ClauseSink {
 
 public:
   SATsolver() {};
   virtual ~SATsolver() {};
 
   virtual void InitSolver(unsigned int numVars)=0;
-  virtual void addClause(vector<int> &clause)=0;
+  // adds n clauses, the i-th clause consists of the literals from
+  // lits[offsets[i]] to lits[offsets[i+1]-1]
+  virtual void addClauses(const int* lits, const uint32_t* offsets, size_t n)=0;
+  void addClause(vector<int> &clause) {
+    uint32_t offsets[2] = { 0, (uint32_t)clause.size() };
+    addClauses(clause.data(), offsets, 1);
+  }
   virtual bool solve()=0;
   virtual bool isTrueVar(unsigned int var)=0;
 };
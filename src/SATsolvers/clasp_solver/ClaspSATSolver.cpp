@@ -76,37 +76,39 @@ void ClaspSATsolver::InitSolver(unsigned int numVars) {
 
 
 
-void ClaspSATsolver::addClause(vector<int> &clause) { 
-  LitVec currentClause;
+void ClaspSATsolver::addClauses(const int* lits, const uint32_t* offsets, size_t n) { 
   ClauseCreator nc(&solver);
-  // bool ret = true;
-  bool sat = false;
-  nc.start();
-
-  // For each var v: 0000p1p2c1c2
-  // p1: set if v occurs negatively in any clause
-  // p2: set if v occurs positively in any clause
-  // c1: set if v occurs negatively in the current clause
-  // c2: set if v occurs positively in the current clause
-  for (vector<int>::iterator it = clause.begin(); it != clause.end(); it++) {
-   int lit = *it;
-   Literal rLit;
-   rLit = lit >= 0 ? posLit(lit) : negLit(-lit);
-   if ( (flags[rLit.var()] & (1+rLit.sign())) == 0 ) {
-     flags[rLit.var()] |= 1+rLit.sign();
-     nc.add(rLit);
-     currentClause.push_back(rLit);
-     if ((flags[rLit.var()] & 3u) == 3u) 
-       sat = true;
-   }
-  }
+  for (size_t i = 0; i < n; i++) {
+    // bool ret = true;
+    bool sat = false;
+    currentClause.clear();
+    nc.start();
+
+    // For each var v: 0000p1p2c1c2
+    // p1: set if v occurs negatively in any clause
+    // p2: set if v occurs positively in any clause
+    // c1: set if v occurs negatively in the current clause
+    // c2: set if v occurs positively in the current clause
+    for (uint32_t j = offsets[i]; j < offsets[i+1]; j++) {
+     int lit = lits[j];
+     Literal rLit;
+     rLit = lit >= 0 ? posLit(lit) : negLit(-lit);
+     if ( (flags[rLit.var()] & (1+rLit.sign())) == 0 ) {
+       flags[rLit.var()] |= 1+rLit.sign();
+       nc.add(rLit);
+       currentClause.push_back(rLit);
+       if ((flags[rLit.var()] & 3u) == 3u) 
+         sat = true;
+     }
+    }
 
-  for (LitVec::iterator it = currentClause.begin(); it != currentClause.end(); ++it) {
-   flags[it->var()] &= ~3u; // clear "in clause"-flags
-   if (!sat) 
-     flags[it->var()] |= ((1 + it->sign()) << 2);
+    for (LitVec::iterator it = currentClause.begin(); it != currentClause.end(); ++it) {
+     flags[it->var()] &= ~3u; // clear "in clause"-flags
+     if (!sat) 
+       flags[it->var()] |= ((1 + it->sign()) << 2);
+    }
+    /*ret =*/ sat || nc.end();
   }
-  /*ret =*/ sat || nc.end();
 }
 
 
@@ -30,7 +30,7 @@ public:
    ClaspSATsolver() { };
    ~ClaspSATsolver() { };
    void InitSolver(unsigned int numVars);
-   void addClause(vector<int> &clause); 
+   void addClauses(const int* lits, const uint32_t* offsets, size_t n);
    bool solve();
    bool isTrueVar(unsigned int var);
 
@@ -41,6 +41,7 @@ private:
 	struct Clasp::Enumerator*   enum_;
 	Clasp::PodVector<uint8>::type flags;
   bool bFirstCall;
+  Clasp::LitVec currentClause;
 
 };
 
@@ -27,16 +27,18 @@ void MiniSATsolver::InitSolver(unsigned int /*numVars*/) {
 }
 
 
-void MiniSATsolver::addClause(vector<int> &clause) { 
-  vec<Lit> literals;
+void MiniSATsolver::addClauses(const int* lits, const uint32_t* offsets, size_t n) { 
   Var var;
-  for (vector<int>::iterator it = clause.begin(); it != clause.end(); it++) {
-    var = abs(*it);
-    while (var > solver.nVars()) 
-       solver.newVar();
-    literals.push ( ((*it) > 0) ? mkLit(var-1,false) : ~mkLit(var-1,false) );
+  for (size_t i = 0; i < n; i++) {
+    literals.clear();
+    for (uint32_t j = offsets[i]; j < offsets[i+1]; j++) {
+      var = abs(lits[j]);
+      while (var > solver.nVars()) 
+         solver.newVar();
+      literals.push ( (lits[j] > 0) ? mkLit(var-1,false) : ~mkLit(var-1,false) );
+    }
+    solver.addClause_(literals); 
   }
-  solver.addClause_(literals); 
 }
 
 
@@ -29,12 +29,13 @@ public:
    MiniSATsolver() { };
    ~MiniSATsolver() { };
    void InitSolver(unsigned int numVars);
-   void addClause(vector<int> &clause); 
+   void addClauses(const int* lits, const uint32_t* offsets, size_t n);
    bool solve();
    bool isTrueVar(unsigned int var);
 
 private:
    Minisat::Solver solver;
+   vec<Lit> literals;
 
 };
 